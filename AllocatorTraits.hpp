@@ -0,0 +1,42 @@
+#ifndef ALLOCATOR_TRAITS_HPP
+# define ALLOCATOR_TRAITS_HPP
+
+# include <cstddef>
+# include <memory>
+
+namespace ft {
+
+	// What the containers may assume about an allocator beyond the standard
+	// interface. Specialise it for your own allocator:
+	//
+	//   plain_construct	construct() and destroy() do nothing but placement
+	//   					new and the destructor, so they can be skipped or
+	//   					replaced by memcpy for trivial types
+	//   can_reallocate		reallocate() may succeed
+	//   reallocate(a, p, old_n, new_n)
+	//   					resizes the block p of old_n elements to new_n,
+	//   					keeping its bytes, possibly at another address.
+	//   					Returns the block, or NULL (p untouched) when the
+	//   					caller has to allocate and copy itself. Only used
+	//   					for trivially relocatable elements.
+	template < class A >
+	struct allocator_ext
+	{
+		static const bool plain_construct = false;
+		static const bool can_reallocate = false;
+
+		static typename A::value_type * reallocate (A &, typename A::value_type *, std::size_t, std::size_t)
+		{	return (NULL);	}
+	};
+
+	template < class T >
+	struct allocator_ext< std::allocator<T> >
+	{
+		static const bool plain_construct = true;
+		static const bool can_reallocate = false;
+
+		static T * reallocate (std::allocator<T> &, T *, std::size_t, std::size_t)	{	return (NULL);	}
+	};
+}
+
+#endif
@@ -0,0 +1,225 @@
+#ifndef DEBUG_HPP
+# define DEBUG_HPP
+
+// Checked mode: build with -DFT_DEBUG and the containers abort with a
+// message on what the standard leaves undefined: operator[] out of range,
+// front() / back() on an empty container, and iterators used after what
+// they pointed to went away (reallocation, insert, erase, clear), walked
+// off either end, or mixed up between containers. Without FT_DEBUG the
+// classes below are empty and every check compiles to nothing.
+
+# include <cstddef>
+
+# ifdef FT_DEBUG
+#  include <cstdio>
+#  include <cstdlib>
+#  include <functional>
+#  define FT_ASSERT(cond, what)	((cond) ? (void)0 : ft::debug_failure(what, __FILE__, __LINE__))
+# else
+#  define FT_ASSERT(cond, what)	((void)0)
+# endif
+
+namespace ft {
+
+# ifdef FT_DEBUG
+
+	inline void debug_failure (const char *what, const char *file, int line)
+	{
+		std::fprintf(stderr, "%s:%d: ft debug: %s\n", file, line, what);
+		std::abort();
+	}
+
+	class debug_owner;
+
+	// Base of the checked iterators. An iterator handed out by a container
+	// sits on the container's list of live iterators until it is destroyed
+	// or reassigned, so the container can mark it singular when what it
+	// points to goes away. One made from a bare pointer has no owner and is
+	// not checked.
+	class debug_iterator
+	{
+		friend class debug_owner;
+
+		const debug_owner *	_owner;
+		debug_iterator *	_prev;
+		debug_iterator *	_next;
+		bool				_singular;
+
+		void	attach (const debug_owner *o);
+		void	detach ();
+
+		protected:
+			debug_iterator () : _owner(NULL), _prev(NULL), _next(NULL), _singular(false) {}
+
+			explicit debug_iterator (const debug_owner *o) : _owner(NULL), _prev(NULL), _next(NULL), _singular(false)
+			{	attach(o);	}
+
+			debug_iterator (const debug_iterator &x) : _owner(NULL), _prev(NULL), _next(NULL), _singular(x._singular)
+			{	attach(x._owner);	}
+
+			debug_iterator & operator= (const debug_iterator &x)
+			{
+				if (this != &x)
+				{
+					detach();
+					_singular = x._singular;
+					attach(x._owner);
+				}
+				return (*this);
+			}
+
+			virtual ~debug_iterator ()	{	detach();	}
+
+			// where the iterator points, for its owner to compare
+			virtual const void *	debugPosition () const = 0;
+
+		public:
+			const debug_owner *	debugOwner () const	{	return (_owner);	}
+
+			void	debugValid () const	{	FT_ASSERT(!_singular, "use of an invalidated iterator");	}
+			void	debugDereferenceable () const	{	debugDereferenceable(debugPosition());	}
+			void	debugDereferenceable (const void *pos) const;
+			void	debugDecrementable () const;
+			void	debugComparable (const debug_iterator &x) const
+			{
+				debugValid();
+				x.debugValid();
+				FT_ASSERT(!_owner || !x._owner || _owner == x._owner, "iterators of different containers");
+			}
+	};
+
+	// Base of the checked containers: the list of their live iterators. A
+	// copy starts with an empty list; the container itself says which of its
+	// iterators an operation invalidates.
+	class debug_owner
+	{
+		friend class debug_iterator;
+
+		enum { ALL, AT, FROM, EXCEPT };
+
+		mutable debug_iterator *	_iterators;
+
+		void invalidate (const void *pos, int how)
+		{
+			debug_iterator *it = _iterators;
+			while (it)
+			{
+				debug_iterator *next = it->_next;
+				const void *p = it->debugPosition();
+				if (how == ALL || (how == AT && p == pos) || (how == EXCEPT && p != pos)
+						|| (how == FROM && !std::less<const void *>()(p, pos)))
+				{
+					it->detach();
+					it->_singular = true;
+				}
+				it = next;
+			}
+		}
+
+		protected:
+			debug_owner () : _iterators(NULL) {}
+			debug_owner (const debug_owner &) : _iterators(NULL) {}
+			debug_owner & operator= (const debug_owner &)	{	return (*this);	}
+			~debug_owner ()	{	debugInvalidateAll();	}
+
+			virtual bool	debugDereferenceable (const void *pos) const = 0;
+			virtual bool	debugDecrementable (const void *pos) const = 0;
+
+			void	debugInvalidateAll ()						{	invalidate(NULL, ALL);		}
+			void	debugInvalidate (const void *pos)			{	invalidate(pos, AT);		}
+			void	debugInvalidateFrom (const void *pos)		{	invalidate(pos, FROM);		}
+			void	debugInvalidateExcept (const void *pos)		{	invalidate(pos, EXCEPT);	}
+
+			// the iterators follow the elements to x and x's come here
+			void debugSwap (debug_owner &x)
+			{
+				debug_iterator *tmp = _iterators;
+				_iterators = x._iterators;
+				x._iterators = tmp;
+				for (debug_iterator *it = _iterators; it; it = it->_next)
+					it->_owner = this;
+				for (debug_iterator *it = x._iterators; it; it = it->_next)
+					it->_owner = &x;
+			}
+
+			// it may be passed to this container's insert / erase
+			void debugOwns (const debug_iterator &it) const
+			{
+				it.debugValid();
+				FT_ASSERT(!it._owner || it._owner == this, "iterator of another container");
+			}
+	};
+
+	inline void debug_iterator::attach (const debug_owner *o)
+	{
+		_owner = o;
+		if (!o)
+			return;
+		_prev = NULL;
+		_next = o->_iterators;
+		if (_next)
+			_next->_prev = this;
+		o->_iterators = this;
+	}
+
+	inline void debug_iterator::detach ()
+	{
+		if (!_owner)
+			return;
+		if (_prev)
+			_prev->_next = _next;
+		else
+			_owner->_iterators = _next;
+		if (_next)
+			_next->_prev = _prev;
+		_owner = NULL;
+		_prev = NULL;
+		_next = NULL;
+	}
+
+	inline void debug_iterator::debugDereferenceable (const void *pos) const
+	{
+		debugValid();
+		FT_ASSERT(!_owner || _owner->debugDereferenceable(pos), "iterator not dereferenceable");
+	}
+
+	inline void debug_iterator::debugDecrementable () const
+	{
+		debugValid();
+		FT_ASSERT(!_owner || _owner->debugDecrementable(debugPosition()), "iterator not decrementable");
+	}
+
+# else
+
+	class debug_owner
+	{
+		protected:
+			void	debugInvalidateAll () const						{}
+			void	debugInvalidate (const void *) const			{}
+			void	debugInvalidateFrom (const void *) const		{}
+			void	debugInvalidateExcept (const void *) const		{}
+			void	debugSwap (debug_owner &) const					{}
+			template <class It>
+			void	debugOwns (const It &) const					{}
+	};
+
+	class debug_iterator
+	{
+		protected:
+			debug_iterator ()								{}
+			explicit debug_iterator (const debug_owner *)	{}
+
+		public:
+			const debug_owner *	debugOwner () const		{	return (NULL);	}
+
+			void	debugValid () const								{}
+			void	debugDereferenceable () const					{}
+			void	debugDereferenceable (const void *) const		{}
+			void	debugDecrementable () const						{}
+			void	debugComparable (const debug_iterator &) const	{}
+	};
+
+# endif
+}
+
+#endif
@@ -0,0 +1,133 @@
+#ifndef GROWTH_POLICY_HPP
+# define GROWTH_POLICY_HPP
+
+# include <cstddef>
+
+namespace ft {
+
+	// A growth policy tells ft::vector how many slots to allocate when it runs
+	// out of room:
+	//
+	//     std::size_t operator() (std::size_t capacity, std::size_t needed,
+	//                             std::size_t elem_size) const;
+	//
+	// returns a capacity of at least needed. After every reallocation the
+	// vector reports back through
+	//
+	//     void reallocated (std::size_t old_cap, std::size_t new_cap,
+	//                       std::size_t bytes_moved);
+	//
+	// and after clear() it asks
+	//
+	//     std::size_t shrink (std::size_t capacity, std::size_t size) const;
+	//
+	// for the capacity to shrink to (capacity itself to keep the buffer).
+	//
+	// The policy lives inside the vector (as an empty base when it has no
+	// state), so each vector gets its own copy.
+
+	struct growth_double
+	{
+		std::size_t operator() (std::size_t capacity, std::size_t needed, std::size_t) const
+		{	return (needed > 2 * capacity ? needed : 2 * capacity);	}
+
+		std::size_t shrink (std::size_t capacity, std::size_t) const	{	return capacity;	}
+
+		void reallocated (std::size_t, std::size_t, std::size_t) {}
+	};
+
+	// grows by half: after a few steps the blocks given back add up to more
+	// than the next request, so the allocator can reuse them
+	struct growth_half
+	{
+		std::size_t operator() (std::size_t capacity, std::size_t needed, std::size_t) const
+		{
+			std::size_t cap = capacity + capacity / 2;
+			return (needed > cap ? needed : cap);
+		}
+
+		std::size_t shrink (std::size_t capacity, std::size_t) const	{	return capacity;	}
+
+		void reallocated (std::size_t, std::size_t, std::size_t) {}
+	};
+
+	// Base's capacity, rounded up so the buffer ends on a page boundary once
+	// it spans a page or more.
+	template < class Base = growth_double, std::size_t Page = 4096 >
+	struct growth_page_rounded : Base
+	{
+		std::size_t operator() (std::size_t capacity, std::size_t needed, std::size_t elem_size) const
+		{
+			std::size_t bytes = Base::operator()(capacity, needed, elem_size) * elem_size;
+			if (bytes >= Page)
+				bytes = (bytes + Page - 1) / Page * Page;
+			return (bytes / elem_size);
+		}
+	};
+
+	// Base's capacity, rounded up to the block glibc's malloc really hands out
+	// for that many bytes, so the slack it keeps anyway becomes capacity.
+	// Chunks are 16-byte granular with an 8-byte header; from the mmap
+	// threshold (128KiB) on, whole pages with a 16-byte header.
+	template < class Base = growth_double >
+	struct growth_size_class : Base
+	{
+		static std::size_t blockSize (std::size_t bytes)
+		{
+			if (bytes + 8 >= 128 * 1024)
+				return ((bytes + 16 + 4095) / 4096 * 4096 - 16);
+			if (bytes < 24)
+				return (24);
+			return ((bytes + 8 + 15) / 16 * 16 - 8);
+		}
+
+		std::size_t operator() (std::size_t capacity, std::size_t needed, std::size_t elem_size) const
+		{	return (blockSize(Base::operator()(capacity, needed, elem_size) * elem_size) / elem_size);	}
+	};
+
+	// Base, but gives memory back: once fewer than Num/Den of the slots are in
+	// use, the buffer shrinks to twice the size (nothing at all when empty).
+	// With Num/Den below 1/2 a shrink is never undone by the next few inserts.
+	// ft::vector only asks on clear(), so erase never moves the elements.
+	template < class Base = growth_double, std::size_t Num = 1, std::size_t Den = 4 >
+	struct growth_shrinking : Base
+	{
+		std::size_t shrink (std::size_t capacity, std::size_t size) const
+		{
+			if (size * Den >= capacity * Num)
+				return (capacity);
+			return (2 * size < capacity ? 2 * size : capacity);
+		}
+	};
+
+	// Wraps a policy and counts what it costs: how many times the buffer was
+	// replaced, how many bytes of elements were moved to do it and the
+	// largest capacity reached.
+	template < class Base = growth_double >
+	class growth_stats : public Base
+	{
+		std::size_t		_reallocations;
+		std::size_t		_bytes_copied;
+		std::size_t		_peak_capacity;
+
+		public:
+			growth_stats () : Base(), _reallocations(0), _bytes_copied(0), _peak_capacity(0) {}
+
+			void reallocated (std::size_t old_cap, std::size_t new_cap, std::size_t bytes_moved)
+			{
+				Base::reallocated(old_cap, new_cap, bytes_moved);
+				_reallocations++;
+				_bytes_copied += bytes_moved;
+				if (new_cap > _peak_capacity)
+					_peak_capacity = new_cap;
+			}
+
+			std::size_t	reallocations () const	{	return _reallocations;	}
+			std::size_t	bytes_copied () const	{	return _bytes_copied;	}
+			std::size_t	peak_capacity () const	{	return _peak_capacity;	}
+
+			void reset ()	{	_reallocations = 0; _bytes_copied = 0; _peak_capacity = 0;	}
+	};
+}
+
+#endif
@@ -5,13 +5,15 @@
 # include <iterator>
 # include "equal.hpp"
 # include "iterator_traits.hpp"
+# include "Debug.hpp"
 
 
 namespace ft
 {	
 	// [ ITERATOR ]
+	// Checked under FT_DEBUG when it comes from a container (see Debug.hpp).
 	template < class U >
-	class iterator
+	class iterator : public ft::debug_iterator
 	{
 		public:
 
@@ -26,42 +28,47 @@ namespace ft
 
 			iterator(void)					:	_it()		{};
 			iterator(pointer it)			:	_it(it) 	{};
-			iterator(const iterator& it)	:	_it(it._it) {};
+			iterator(pointer it, const ft::debug_owner *owner)	:	ft::debug_iterator(owner), _it(it)	{};
+			iterator(const iterator& it)	:	ft::debug_iterator(it), _it(it._it) {};
 			~iterator(void)									{};
 
 			pointer			base() const 	{	return  _it;	};
 
-			iterator	operator = (const iterator& r)				{	_it = r.base();	return  *this;		};
-			iterator	operator + (difference_type n) const		{	return  iterator(base() + n);		};
-			iterator&	operator ++ ()								{	_it += 1;	return  *this;			};
-			iterator	operator ++ (int)							{	iterator tmp= *this; _it += 1; return  tmp;	};
-			iterator&	operator += (difference_type n)				{	_it += n;	return  *this;			};
+			iterator	operator = (const iterator& r)				{	ft::debug_iterator::operator=(r); _it = r.base();	return  *this;	};
+			iterator	operator + (difference_type n) const		{	iterator tmp = *this; return  tmp += n;		};
+			iterator&	operator ++ ()								{	debugDereferenceable(); _it += 1;	return  *this;	};
+			iterator	operator ++ (int)							{	iterator tmp= *this; ++*this; return  tmp;	};
+			iterator&	operator += (difference_type n)				{	debugValid(); _it += n;	return  *this;	};
 
-			iterator	operator - (difference_type n) const 		{ 	return  iterator(base() - n); 		};
-			iterator&	operator -- ()								{	_it -= 1; return  *this;			};
-			iterator	operator -- (int)							{	iterator tmp= *this; _it--; return  tmp;	}; // to check
-			iterator	operator-=(difference_type n)				{	_it -= n;	return  *this;			};
+			iterator	operator - (difference_type n) const 		{ 	iterator tmp = *this; return  tmp -= n;		};
+			iterator&	operator -- ()								{	debugDecrementable(); _it -= 1; return  *this;	};
+			iterator	operator -- (int)							{	iterator tmp= *this; --*this; return  tmp;	};
+			iterator	operator-=(difference_type n)				{	debugValid(); _it -= n;	return  *this;	};
 
-			reference		operator*() 							{	return  *_it;						};
-			const_reference	operator*() const 						{	return  *_it;						};
+			reference		operator*() 							{	debugDereferenceable(); return  *_it;	};
+			const_reference	operator*() const 						{	debugDereferenceable(); return  *_it;	};
 
 			pointer			operator->() 							{	return &(operator*());				};
 			const_pointer	operator->() const 						{	return &(operator*());				};
 
-			reference		operator[] (difference_type n) 			{	return  base()[n];					};
-			const_reference	operator[] (difference_type n) const 	{ 	return  base()[n];					};
+			reference		operator[] (difference_type n) 			{	debugDereferenceable(_it + n); return  base()[n];	};
+			const_reference	operator[] (difference_type n) const 	{ 	debugDereferenceable(_it + n); return  base()[n];	};
 
-			friend bool		operator == (const iterator& l, const iterator& r) 		{	return  l.base() == r.base();	};
-			friend bool		operator != (const iterator& l, const iterator& r)		{	return  l.base() != r.base();	};
-			friend bool		operator > (const iterator& l, const iterator& r) 		{	return  l.base() > r.base();	};
-			friend bool		operator <= (const iterator& l, const iterator& r) 		{	return  l.base() <= r.base();	};
-			friend bool		operator < (const iterator& l, const iterator& r) 		{	return  l.base() < r.base();	};
-			friend bool 	operator >= (const iterator& l, const iterator& r) 		{	return  l.base() >= r.base();	};
+			friend bool		operator == (const iterator& l, const iterator& r) 		{	l.debugComparable(r); return  l.base() == r.base();	};
+			friend bool		operator != (const iterator& l, const iterator& r)		{	l.debugComparable(r); return  l.base() != r.base();	};
+			friend bool		operator > (const iterator& l, const iterator& r) 		{	l.debugComparable(r); return  l.base() > r.base();	};
+			friend bool		operator <= (const iterator& l, const iterator& r) 		{	l.debugComparable(r); return  l.base() <= r.base();	};
+			friend bool		operator < (const iterator& l, const iterator& r) 		{	l.debugComparable(r); return  l.base() < r.base();	};
+			friend bool 	operator >= (const iterator& l, const iterator& r) 		{	l.debugComparable(r); return  l.base() >= r.base();	};
 
-			operator 		const_iterator () const									{	return const_iterator(_it);		};
+			operator 		const_iterator () const									{	debugValid(); return const_iterator(_it, debugOwner());	};
 
 		private:
 			pointer	_it;
+
+# ifdef FT_DEBUG
+			const void *	debugPosition () const	{	return (_it);	};
+# endif
 	};
 
 /////////////////////////////////////////////////////////////////////////
@@ -73,7 +80,7 @@ namespace ft
 
 	template <class Iter1, class Iter2>
 	typename iterator<Iter1>::difference_type operator - ( const iterator<Iter1>& l,	
-																   const iterator<Iter2>& r )		{		return  l.base() - r.base(); };
+																   const iterator<Iter2>& r )		{		l.debugComparable(r); return  l.base() - r.base(); };
 
 	// [	REVERSE ITERATOR	]
 	template <class iterator>
@@ -120,7 +127,7 @@ namespace ft
 
 	template <class Iter1, class Iter2>
 	bool	operator == ( const iterator<Iter1>& l,
-						const iterator<Iter2>& r ) 				{	return  l.base() == r.base();	};
+						const iterator<Iter2>& r ) 				{	l.debugComparable(r); return  l.base() == r.base();	};
 
 	template <class Iter1, class Iter2>
 	bool	operator == ( const reverse_iterator<Iter1>& l,
@@ -0,0 +1,148 @@
+#ifndef ITERATOR_BIT_HPP
+# define ITERATOR_BIT_HPP
+
+# include <cstddef>
+# include <climits>
+# include "equal.hpp"
+# include "iterator_traits.hpp"
+
+namespace ft
+{
+	// the words a packed ft::vector<bool> keeps its flags in
+	typedef unsigned long long	bit_word;
+	static const std::size_t	bit_word_bits = sizeof(bit_word) * CHAR_BIT;
+
+	// What ft::vector<bool> hands out instead of a bool &: the word the flag
+	// lives in and its mask. Reads as a bool, assignment writes the bit.
+	class BitReference
+	{
+		bit_word *	word;
+		bit_word	mask;
+
+		public:
+			BitReference	(bit_word *word, bit_word mask)	: word(word), mask(mask)	{}
+			BitReference	(const BitReference & x)		: word(x.word), mask(x.mask)	{}
+
+			operator bool	() const	{ return ((*word & mask) != 0); }
+			bool			operator~	() const	{ return ((*word & mask) == 0); }
+
+			BitReference &	operator=	(bool x)
+			{
+				if (x)
+					*word |= mask;
+				else
+					*word &= ~mask;
+				return (*this);
+			}
+
+			BitReference &	operator=	(const BitReference & x)	{ return (*this = bool(x)); }
+
+			void			flip		()	{ *word ^= mask; }
+	};
+
+	inline void	swap	(BitReference x, BitReference y)
+	{
+		bool tmp = x;
+		x = y;
+		y = tmp;
+	}
+
+	// Random access iterator over packed bits: a word and a bit inside it.
+	template <bool IsConst>
+		class IteratorBit {
+			public:
+				typedef bool																value_type;
+				typedef typename		ft::conditional<IsConst, bool, BitReference>::type			reference;
+				typedef typename		ft::conditional<IsConst, const bool *, BitReference *>::type	pointer;
+				typedef typename		ft::conditional<IsConst, const bit_word *, bit_word *>::type	word_pointer;
+				typedef ft::random_access_iterator_tag										iterator_category;
+				typedef					std::ptrdiff_t										difference_type;
+
+			private:
+				word_pointer	word;
+				std::size_t		bit;
+
+				static BitReference	at	(bit_word *w, std::size_t b)		{ return (BitReference(w, bit_word(1) << b)); }
+				static bool			at	(const bit_word *w, std::size_t b)	{ return (((*w >> b) & 1) != 0); }
+
+			public:
+			////////////////---CONSTRUCTORS & DESTRUCTOR---////////////////////////////
+				IteratorBit	()		: word(NULL), bit(0)		{}
+
+				IteratorBit	(word_pointer word, std::size_t bit)	: word(word), bit(bit)	{}
+
+				template <bool B>
+				IteratorBit	(const IteratorBit<B> & other, typename ft::enable_if<!B>::type* = 0)
+					: word(other.getWord()), bit(other.getBit())	{}
+
+				~IteratorBit	(void)	{}
+			///////////////////////////////////////////////////////////////////////////
+
+				template <bool B> bool	operator==	(const IteratorBit<B> & x) const	{ return (word == x.getWord() && bit == x.getBit()); }
+				template <bool B> bool	operator!=	(const IteratorBit<B> & x) const	{ return (!(*this == x)); }
+				template <bool B> bool	operator<	(const IteratorBit<B> & x) const	{ return ((*this - x) < 0); }
+				template <bool B> bool	operator>	(const IteratorBit<B> & x) const	{ return ((*this - x) > 0); }
+				template <bool B> bool	operator<=	(const IteratorBit<B> & x) const	{ return ((*this - x) <= 0); }
+				template <bool B> bool	operator>=	(const IteratorBit<B> & x) const	{ return ((*this - x) >= 0); }
+
+				template <bool B> difference_type	operator-	(const IteratorBit<B> & x) const
+				{
+					return ((word - x.getWord()) * static_cast<difference_type>(bit_word_bits)
+							+ static_cast<difference_type>(bit) - static_cast<difference_type>(x.getBit()));
+				}
+
+				IteratorBit &	operator++	()
+				{
+					if (++bit == bit_word_bits)
+					{
+						bit = 0;
+						++word;
+					}
+					return (*this);
+				}
+
+				IteratorBit &	operator--	()
+				{
+					if (bit-- == 0)
+					{
+						bit = bit_word_bits - 1;
+						--word;
+					}
+					return (*this);
+				}
+
+				IteratorBit		operator++	(int)	{ IteratorBit x(*this); ++*this; return (x); }
+				IteratorBit		operator--	(int)	{ IteratorBit x(*this); --*this; return (x); }
+
+				IteratorBit &	operator+=	(difference_type n)
+				{
+					difference_type b = static_cast<difference_type>(bit) + n;
+					difference_type w = b / static_cast<difference_type>(bit_word_bits);
+					b %= static_cast<difference_type>(bit_word_bits);
+					if (b < 0)
+					{
+						b += bit_word_bits;
+						--w;
+					}
+					word += w;
+					bit = b;
+					return (*this);
+				}
+
+				IteratorBit &	operator-=	(difference_type n)			{ return (*this += -n); }
+				IteratorBit		operator+	(difference_type n) const	{ IteratorBit x(*this); return (x += n); }
+				IteratorBit		operator-	(difference_type n) const	{ IteratorBit x(*this); return (x += -n); }
+
+				reference		operator*	() const					{ return (at(word, bit)); }
+				reference		operator[]	(difference_type n) const	{ return (*(*this + n)); }
+
+				word_pointer	getWord		() const	{ return word; }
+				std::size_t		getBit		() const	{ return bit; }
+			};
+
+	template <bool IsConst>
+		IteratorBit<IsConst>	operator+	(std::ptrdiff_t n, const IteratorBit<IsConst> & it)
+		{ return (it + n); }
+}
+
+#endif
@@ -6,11 +6,12 @@
 # include "iterator_traits.hpp"
 # include "pair.hpp"
 # include "Node.hpp"
+# include "Debug.hpp"
 
 namespace ft
 {
     template <bool IsConst, class Val>
-		class IteratorMap { 
+		class IteratorMap : public ft::debug_iterator { 
 			public:
 				typedef typename		ft::conditional<IsConst, const Val, Val>::type	            value_type;
 				typedef ft::node< Val >                                                             node;
@@ -30,26 +31,31 @@ namespace ft
 				IteratorMap		()										{ ptr = NULL; }
 
 				IteratorMap		(node *ptr)	: ptr(ptr)		{}
+
+				IteratorMap		(node *ptr, const ft::debug_owner *owner)	: ft::debug_iterator(owner), ptr(ptr)	{}
+
+				IteratorMap		(const IteratorMap & other)	: ft::debug_iterator(other), ptr(other.ptr)	{}
 				
 				template <bool B>
-				IteratorMap	(const IteratorMap<B, Val> & other, typename ft::enable_if<!B>::type* = 0)	: ptr(other.getPtr())	{}
+				IteratorMap	(const IteratorMap<B, Val> & other, typename ft::enable_if<!B>::type* = 0)
+					: ft::debug_iterator(other.debugOwner()), ptr(other.getPtr())	{ other.debugValid(); }
 
 				IteratorMap &operator=	(const IteratorMap& other)	
-				{ ptr = other.getPtr(); return (*this); }
+				{ ft::debug_iterator::operator=(other); ptr = other.getPtr(); return (*this); }
 
 				virtual ~IteratorMap	(void)	{}
 			///////////////////////////////////////////////////////////////////////////
 
-				template <bool B> bool	operator==	(const IteratorMap<B, Val> & x) const	{ return (ptr == x.getPtr()); }
-				template <bool B> bool	operator!=	(const IteratorMap<B, Val> & x) const	{ return (ptr != x.getPtr()); }
+				template <bool B> bool	operator==	(const IteratorMap<B, Val> & x) const	{ debugComparable(x); return (ptr == x.getPtr()); }
+				template <bool B> bool	operator!=	(const IteratorMap<B, Val> & x) const	{ debugComparable(x); return (ptr != x.getPtr()); }
 				
-				IteratorMap &	operator++	()		{ this->nextNode(); return (*this); }
-				IteratorMap &	operator--	()		{ this->prevNode(); return (*this); }
-				IteratorMap		operator++	(int)	{ IteratorMap<IsConst, Val> x(*this); this->nextNode(); return (x); }
-				IteratorMap		operator--	(int)	{ IteratorMap<IsConst, Val> x(*this); this->prevNode(); return (x); }
+				IteratorMap &	operator++	()		{ debugDereferenceable(); this->nextNode(); return (*this); }
+				IteratorMap &	operator--	()		{ debugDecrementable(); this->prevNode(); return (*this); }
+				IteratorMap		operator++	(int)	{ IteratorMap<IsConst, Val> x(*this); ++*this; return (x); }
+				IteratorMap		operator--	(int)	{ IteratorMap<IsConst, Val> x(*this); --*this; return (x); }
 
-				value_type &	operator*	() const	{ return (ptr->data); }
-				value_type *	operator->	() const	{ return (&(ptr->data)); }
+				value_type &	operator*	() const	{ debugDereferenceable(); return (ptr->data); }
+				value_type *	operator->	() const	{ debugDereferenceable(); return (&(ptr->data)); }
 				
 				node  * 	getPtr	() const    { return ptr;     }
 				
@@ -59,47 +65,43 @@ namespace ft
 				
 			private:
 
+# ifdef FT_DEBUG
+				const void *	debugPosition	() const	{ return (ptr); }
+# endif
+
 				void nextNode()
 				{
-					if (ptr->nil)
-						return ;
-					if (!ptr->right->nil)
+					if (ptr->right)
 					{
 						ptr = ptr->right;
-						while (!ptr->nil && !ptr->left->nil)
+						while (ptr->left)
 							ptr = ptr->left;
 					}
 					else
 					{
-						node *tmp = ptr;
-						while (tmp->parent && tmp == tmp->parent->right)
-							tmp = tmp->parent;
-						if (tmp->parent)
-							ptr = tmp->parent;
-						else
-							ptr = ptr->right;
+						node *y = ptr->parent();
+						while (ptr == y->right)
+						{	ptr = y; y = y->parent();	}
+						if (ptr->right != y)	// the root is the rightmost node
+							ptr = y;
 					}
 				};
 
 				void prevNode()
 				{
-					node *				tmp = ptr;
-					if (!ptr->nil && !ptr->left->nil)
+					if (ptr->isHeader())
+						ptr = ptr->right;	// the header keeps the rightmost node
+					else if (ptr->left)
 					{	
 						ptr = ptr->left;
-						while (!ptr->right->nil) ptr = ptr->right;
+						while (ptr->right) ptr = ptr->right;
 					}
-					else if(ptr->parent)
+					else
 					{
-						if (ptr->nil)
-							ptr = ptr->parent;
-						else
-						{
-							while (tmp->parent && tmp == tmp->parent->left)
-								tmp = tmp->parent;
-							if (tmp->parent)
-								ptr = tmp->parent;
-						}
+						node *y = ptr->parent();
+						while (ptr == y->left)
+						{	ptr = y; y = y->parent();	}
+						ptr = y;
 					}
 				};
 		};
@@ -124,13 +126,11 @@ namespace ft
 			////////////////---CONSTRUCTORS & DESTRUCTOR---////////////////////////////
 				IteratorRevMap		()	{}
 
-				// IteratorRevMap		(node *ptr) : ptr(ptr)	{}
-
 				template <bool C>
-				IteratorRevMap		(const IteratorMap<C, Val> & it)	: b_it(convert_base_to_rev(it))	{}
+				IteratorRevMap		(const IteratorMap<C, Val> & it)	: b_it(it)	{}
 				
 				template <bool C>
-				IteratorRevMap	(const IteratorRevMap<C, Val> & other, typename ft::enable_if<!C>::type* = 0) : b_it(other.getIt())	{}
+				IteratorRevMap	(const IteratorRevMap<C, Val> & other, typename ft::enable_if<!C>::type* = 0) : b_it(other.base())	{}
 
 				IteratorRevMap &operator=	(const IteratorRevMap & other)	
 				{ b_it = other.b_it; return (*this); }
@@ -141,71 +141,15 @@ namespace ft
 				template <bool C> bool	operator==	(const IteratorRevMap<C, Val> & x) const	{ return (getPtr() == x.getPtr()); }
 				template <bool C> bool	operator!=	(const IteratorRevMap<C, Val> & x) const	{ return (getPtr() != x.getPtr()); }
 				
-				IteratorRevMap &	operator++	()		{ nextRev(); return (*this); } // ++it
-				IteratorRevMap &	operator--	()		{ prevRev(); return (*this); } // --it;
-				IteratorRevMap		operator++	(int)	{ IteratorRevMap<IsRConst, Val> x(*this); nextRev(); return (x); } // it++;
-				IteratorRevMap		operator--	(int)	{ IteratorRevMap<IsRConst, Val> x(*this); prevRev(); return (x); }
+				IteratorRevMap &	operator++	()		{ --b_it; return (*this); } // ++it
+				IteratorRevMap &	operator--	()		{ ++b_it; return (*this); } // --it;
+				IteratorRevMap		operator++	(int)	{ IteratorRevMap<IsRConst, Val> x(*this); --b_it; return (x); } // it++;
+				IteratorRevMap		operator--	(int)	{ IteratorRevMap<IsRConst, Val> x(*this); ++b_it; return (x); }
 				
-				IteratorMap<IsRConst, Val>	base	() 	{ return (convert_rev_to_base(b_it)); }
-				value_type &	operator*	(void) const	{ return (getPtr()->data); }
-				value_type *	operator->	(void) const	{ return (&getPtr()->data); }
+				iterator	base	() const	{ return (b_it); }
+				value_type &	operator*	(void) const	{ iterator tmp(b_it); return (*--tmp); }
+				value_type *	operator->	(void) const	{ return (&operator*()); }
 				node  * 	getPtr		(void) const    { return b_it.getPtr();     };
-				iterator		getIt		(void) const	{ return (b_it); }
-
-			private:
-				IteratorMap<IsRConst, Val> convert_base_to_rev(IteratorMap<IsRConst, Val> it)
-				{
-					IteratorMap<IsRConst, Val> tmp(it.getPtr());
-					if ( it == --tmp)
-					{
-						IteratorMap<IsRConst, Val> ret(tmp.getPtr()->left);
-						tmp = ret;
-					}	
-					else
-					{
-						IteratorMap<IsRConst,Val> ret(tmp.getPtr());
-						tmp = ret;
-					}
-					return tmp;
-				}
-
-				IteratorMap<IsRConst, Val> convert_rev_to_base(IteratorMap<IsRConst, Val> it)
-				{
-					IteratorMap<IsRConst, Val> tmp(it.getPtr());
-					if (getPtr()->nil)
-						while (it != --tmp) it = tmp;
-					else
-					{
-						++tmp;
-						if (tmp.getPtr()->nil)
-							--tmp;
-					}
-					IteratorMap<IsRConst, Val> ret(tmp.getPtr());
-					return ret;
-				}
-
-				void nextRev()
-				{
-					IteratorMap<IsRConst, Val> tmp(getPtr());
-					--b_it;
-					if (tmp == b_it)
-					{
-						IteratorMap<IsRConst, Val> ret(getPtr()->left);
-						b_it = ret;
-					}
-				}
-
-				void prevRev()
-				{
-					IteratorMap<IsRConst, Val> tmp = b_it;
-					if (getPtr()->nil)
-						while (tmp != --b_it) tmp = b_it;
-					else
-					{	++b_it;
-						if (getPtr()->nil)
-							--b_it;}
-				}
-
 		};
 }
 
@@ -0,0 +1,79 @@
+#ifndef ITERATOR_SEGMENTED_HPP
+# define ITERATOR_SEGMENTED_HPP
+
+# include <cstddef>
+# include "equal.hpp"
+# include "iterator_traits.hpp"
+
+namespace ft
+{
+	// Random access iterator over a container whose elements are not one
+	// plain array (segmented_vector, incremental_vector, packed_vector): the
+	// container and an index, going through its operator[], so it hands out
+	// whatever that returns, a proxy included. It survives push_back as long
+	// as it does not point past the end.
+	template <bool IsConst, class Seg>
+		class IteratorSegmented {
+			public:
+				typedef typename		Seg::value_type											val_type;
+				typedef typename		ft::conditional<IsConst, const val_type, val_type>::type	value_type;
+				typedef typename		ft::conditional<IsConst, const Seg, Seg>::type			container_type;
+				typedef typename		ft::conditional<IsConst, typename Seg::const_pointer,
+											typename Seg::pointer>::type						pointer;
+				typedef typename		ft::conditional<IsConst, typename Seg::const_reference,
+											typename Seg::reference>::type					reference;
+				typedef ft::random_access_iterator_tag											iterator_category;
+				typedef					std::ptrdiff_t											difference_type;
+				typedef					std::size_t												size_type;
+
+			private:
+				container_type *	seg;
+				size_type			pos;
+
+			public:
+			////////////////---CONSTRUCTORS & DESTRUCTOR---////////////////////////////
+				IteratorSegmented	()		: seg(NULL), pos(0)		{}
+
+				IteratorSegmented	(container_type *seg, size_type pos)	: seg(seg), pos(pos)	{}
+
+				template <bool B>
+				IteratorSegmented	(const IteratorSegmented<B, Seg> & other, typename ft::enable_if<!B>::type* = 0)
+					: seg(other.getContainer()), pos(other.getPos())	{}
+
+				~IteratorSegmented	(void)	{}
+			///////////////////////////////////////////////////////////////////////////
+
+				template <bool B> bool	operator==	(const IteratorSegmented<B, Seg> & x) const	{ return (pos == x.getPos()); }
+				template <bool B> bool	operator!=	(const IteratorSegmented<B, Seg> & x) const	{ return (pos != x.getPos()); }
+				template <bool B> bool	operator<	(const IteratorSegmented<B, Seg> & x) const	{ return (pos < x.getPos()); }
+				template <bool B> bool	operator>	(const IteratorSegmented<B, Seg> & x) const	{ return (pos > x.getPos()); }
+				template <bool B> bool	operator<=	(const IteratorSegmented<B, Seg> & x) const	{ return (pos <= x.getPos()); }
+				template <bool B> bool	operator>=	(const IteratorSegmented<B, Seg> & x) const	{ return (pos >= x.getPos()); }
+
+				template <bool B> difference_type	operator-	(const IteratorSegmented<B, Seg> & x) const
+				{ return (static_cast<difference_type>(pos) - static_cast<difference_type>(x.getPos())); }
+
+				IteratorSegmented &	operator++	()		{ ++pos; return (*this); }
+				IteratorSegmented &	operator--	()		{ --pos; return (*this); }
+				IteratorSegmented	operator++	(int)	{ IteratorSegmented x(*this); ++pos; return (x); }
+				IteratorSegmented	operator--	(int)	{ IteratorSegmented x(*this); --pos; return (x); }
+
+				IteratorSegmented &	operator+=	(difference_type n)			{ pos += n; return (*this); }
+				IteratorSegmented &	operator-=	(difference_type n)			{ pos -= n; return (*this); }
+				IteratorSegmented	operator+	(difference_type n) const	{ return (IteratorSegmented(seg, pos + n)); }
+				IteratorSegmented	operator-	(difference_type n) const	{ return (IteratorSegmented(seg, pos - n)); }
+
+				reference		operator*	() const					{ return ((*seg)[pos]); }
+				pointer			operator->	() const					{ return (&(*seg)[pos]); }
+				reference		operator[]	(difference_type n) const	{ return ((*seg)[pos + n]); }
+
+				container_type *	getContainer	() const	{ return seg; }
+				size_type			getPos			() const	{ return pos; }
+		};
+
+	template <bool IsConst, class Seg>
+		IteratorSegmented<IsConst, Seg>	operator+	(std::ptrdiff_t n, const IteratorSegmented<IsConst, Seg> & it)
+		{ return (it + n); }
+}
+
+#endif
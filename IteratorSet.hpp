@@ -6,11 +6,12 @@
 # include "iterator_traits.hpp"
 # include "pair.hpp"
 # include "Node.hpp"
+# include "Debug.hpp"
 
 namespace ft
 {
     template <bool IsConst, class Val>
-		class IteratorSet { 
+		class IteratorSet : public ft::debug_iterator { 
 			public:
 				typedef typename		ft::conditional<IsConst, const Val, Val>::type	            value_type;
 				typedef ft::node< Val >                                                             node;
@@ -30,78 +31,79 @@ namespace ft
 				IteratorSet		()										{ ptr = NULL; }
 
 				IteratorSet		(node *ptr)	: ptr(ptr)		{}
+
+				IteratorSet		(node *ptr, const ft::debug_owner *owner)	: ft::debug_iterator(owner), ptr(ptr)	{}
+
+				IteratorSet		(const IteratorSet & other)	: ft::debug_iterator(other), ptr(other.ptr)	{}
 				
 				template <bool B>
-				IteratorSet	(const IteratorSet<B, Val> & other, typename ft::enable_if<!B>::type* = 0)	: ptr(other.getPtr())	{}
+				IteratorSet	(const IteratorSet<B, Val> & other, typename ft::enable_if<!B>::type* = 0)
+					: ft::debug_iterator(other.debugOwner()), ptr(other.getPtr())	{ other.debugValid(); }
 
 				IteratorSet &operator=	(const IteratorSet& other)	
-				{ ptr = other.getPtr(); return (*this); }
+				{ ft::debug_iterator::operator=(other); ptr = other.getPtr(); return (*this); }
 
 				virtual ~IteratorSet	(void)	{}
 			///////////////////////////////////////////////////////////////////////////
 
-				template <bool B> bool	operator==	(const IteratorSet<B, Val> & x) const	{ return (ptr == x.getPtr()); }
-				template <bool B> bool	operator!=	(const IteratorSet<B, Val> & x) const	{ return (ptr != x.getPtr()); }
+				template <bool B> bool	operator==	(const IteratorSet<B, Val> & x) const	{ debugComparable(x); return (ptr == x.getPtr()); }
+				template <bool B> bool	operator!=	(const IteratorSet<B, Val> & x) const	{ debugComparable(x); return (ptr != x.getPtr()); }
 				
-				IteratorSet &	operator++	()		{ this->nextNode(); return (*this); }
-				IteratorSet &	operator--	()		{ this->prevNode(); return (*this); }
-				IteratorSet		operator++	(int)	{ IteratorSet<IsConst, Val> x(*this); this->nextNode(); return (x); }
-				IteratorSet		operator--	(int)	{ IteratorSet<IsConst, Val> x(*this); this->prevNode(); return (x); }
+				IteratorSet &	operator++	()		{ debugDereferenceable(); this->nextNode(); return (*this); }
+				IteratorSet &	operator--	()		{ debugDecrementable(); this->prevNode(); return (*this); }
+				IteratorSet		operator++	(int)	{ IteratorSet<IsConst, Val> x(*this); ++*this; return (x); }
+				IteratorSet		operator--	(int)	{ IteratorSet<IsConst, Val> x(*this); --*this; return (x); }
 
 				// value_type & 	operator*	() 	{ return (ptr->data); }
 				// value_type *	operator->	() 	{ return (&(ptr->data)); }
-				const value_type & 	operator*	() const	{ return (ptr->data); }
-				const value_type *	operator->	() const	{ return (&(ptr->data)); }
+				const value_type & 	operator*	() const	{ debugDereferenceable(); return (ptr->data); }
+				const value_type *	operator->	() const	{ debugDereferenceable(); return (&(ptr->data)); }
 				
 				node  * 	getPtr	() const    { return ptr;     }
 				
 				IteratorSet<IsConst, Val> 	base	() 	{ return (*this);}
 				
-				operator  IteratorSet<false, Val> () const		{	return IteratorSet<false, Val>(ptr);		};
+				operator  IteratorSet<false, Val> () const		{	debugValid(); return IteratorSet<false, Val>(ptr, debugOwner());		};
 				
 			private:
 
+# ifdef FT_DEBUG
+				const void *	debugPosition	() const	{ return (ptr); }
+# endif
+
 				void nextNode()
 				{
-					if (ptr->nil)
-						return ;
-					if (!ptr->right->nil)
+					if (ptr->right)
 					{
 						ptr = ptr->right;
-						while (!ptr->nil && !ptr->left->nil)
+						while (ptr->left)
 							ptr = ptr->left;
 					}
 					else
 					{
-						node *tmp = ptr;
-						while (tmp->parent && tmp == tmp->parent->right)
-							tmp = tmp->parent;
-						if (tmp->parent)
-							ptr = tmp->parent;
-						else
-							ptr = ptr->right;
+						node *y = ptr->parent();
+						while (ptr == y->right)
+						{	ptr = y; y = y->parent();	}
+						if (ptr->right != y)	// the root is the rightmost node
+							ptr = y;
 					}
 				};
 
 				void prevNode()
 				{
-					node *				tmp = ptr;
-					if (!ptr->nil && !ptr->left->nil)
+					if (ptr->isHeader())
+						ptr = ptr->right;	// the header keeps the rightmost node
+					else if (ptr->left)
 					{	
 						ptr = ptr->left;
-						while (!ptr->right->nil) ptr = ptr->right;
+						while (ptr->right) ptr = ptr->right;
 					}
-					else if(ptr->parent)
+					else
 					{
-						if (ptr->nil)
-							ptr = ptr->parent;
-						else
-						{
-							while (tmp->parent && tmp == tmp->parent->left)
-								tmp = tmp->parent;
-							if (tmp->parent)
-								ptr = tmp->parent;
-						}
+						node *y = ptr->parent();
+						while (ptr == y->left)
+						{	ptr = y; y = y->parent();	}
+						ptr = y;
 					}
 				};
 		};
@@ -126,13 +128,11 @@ namespace ft
 			////////////////---CONSTRUCTORS & DESTRUCTOR---////////////////////////////
 				IteratorRevSet		()	{}
 
-				// IteratorRevSet		(node *ptr) : ptr(ptr)	{}
-
 				template <bool C>
-				IteratorRevSet		(const IteratorSet<C, Val> & it)	: b_it(convert_base_to_rev(it))	{}
+				IteratorRevSet		(const IteratorSet<C, Val> & it)	: b_it(it)	{}
 				
 				template <bool C>
-				IteratorRevSet	(const IteratorRevSet<C, Val> & other, typename ft::enable_if<!C>::type* = 0) : b_it(other.getIt())	{}
+				IteratorRevSet	(const IteratorRevSet<C, Val> & other, typename ft::enable_if<!C>::type* = 0) : b_it(other.base())	{}
 
 				IteratorRevSet &operator=	(const IteratorRevSet & other)	
 				{ b_it = other.b_it; return (*this); }
@@ -143,73 +143,15 @@ namespace ft
 				template <bool C> bool	operator==	(const IteratorRevSet<C, Val> & x) const	{ return (getPtr() == x.getPtr()); }
 				template <bool C> bool	operator!=	(const IteratorRevSet<C, Val> & x) const	{ return (getPtr() != x.getPtr()); }
 				
-				IteratorRevSet &	operator++	()		{ nextRev(); return (*this); } // ++it
-				IteratorRevSet &	operator--	()		{ prevRev(); return (*this); } // --it;
-				IteratorRevSet		operator++	(int)	{ IteratorRevSet<IsRConst, Val> x(*this); nextRev(); return (x); } // it++;
-				IteratorRevSet		operator--	(int)	{ IteratorRevSet<IsRConst, Val> x(*this); prevRev(); return (x); }
+				IteratorRevSet &	operator++	()		{ --b_it; return (*this); } // ++it
+				IteratorRevSet &	operator--	()		{ ++b_it; return (*this); } // --it;
+				IteratorRevSet		operator++	(int)	{ IteratorRevSet<IsRConst, Val> x(*this); --b_it; return (x); } // it++;
+				IteratorRevSet		operator--	(int)	{ IteratorRevSet<IsRConst, Val> x(*this); ++b_it; return (x); }
 				
-				IteratorSet<IsRConst, Val>	base	() 	{ return (convert_rev_to_base(b_it)); }
-				// value_type &	operator*	(void) 	{ return (getPtr()->data); }
-				// value_type *	operator->	(void) 	{ return (&getPtr()->data); }
-				const value_type &	operator*	(void) const	{ return (getPtr()->data); }
-				const value_type *	operator->	(void) const	{ return (&getPtr()->data); }
+				iterator	base	() const	{ return (b_it); }
+				const value_type &	operator*	(void) const	{ iterator tmp(b_it); return (*--tmp); }
+				const value_type *	operator->	(void) const	{ return (&operator*()); }
 				node  * 	getPtr		(void) const    { return b_it.getPtr();     };
-				iterator		getIt		(void) const	{ return (b_it); }
-
-			private:
-				IteratorSet<IsRConst, Val> convert_base_to_rev(IteratorSet<IsRConst, Val> it)
-				{
-					IteratorSet<IsRConst, Val> tmp(it.getPtr());
-					if ( it == --tmp)
-					{
-						IteratorSet<IsRConst, Val> ret(tmp.getPtr()->left);
-						tmp = ret;
-					}	
-					else
-					{
-						IteratorSet<IsRConst,Val> ret(tmp.getPtr());
-						tmp = ret;
-					}
-					return tmp;
-				}
-
-				IteratorSet<IsRConst, Val> convert_rev_to_base(IteratorSet<IsRConst, Val> it)
-				{
-					IteratorSet<IsRConst, Val> tmp(it.getPtr());
-					if (getPtr()->nil)
-						while (it != --tmp) it = tmp;
-					else
-					{
-						++tmp;
-						if (tmp.getPtr()->nil)
-							--tmp;
-					}
-					IteratorSet<IsRConst, Val> ret(tmp.getPtr());
-					return ret;
-				}
-
-				void nextRev()
-				{
-					IteratorSet<IsRConst, Val> tmp(getPtr());
-					--b_it;
-					if (tmp == b_it)
-					{
-						IteratorSet<IsRConst, Val> ret(getPtr()->left);
-						b_it = ret;
-					}
-				}
-
-				void prevRev()
-				{
-					IteratorSet<IsRConst, Val> tmp = b_it;
-					if (getPtr()->nil)
-						while (tmp != --b_it) tmp = b_it;
-					else
-					{	++b_it;
-						if (getPtr()->nil)
-							--b_it;}
-				}
-
 		};
 }
 
@@ -1,26 +1,54 @@
 #ifndef NODE_HPP
 #define NODE_HPP
 
+# include <cstddef>
+
 namespace ft{
 
     enum {BLACK = false, RED = true};
+
+    // Links of a tree node. The colour lives in the low bit of the parent
+    // pointer (nodes are at least pointer aligned), so the links cost three
+    // words and node< pair<int, int> > fits in 32 bytes.
+    template < class Node >
+    struct		node_links
+    {
+        Node *					left;
+        Node *					right;
+        std::size_t				parent_color;
+
+        node_links ( void ) : left(0), right(0), parent_color(0) {}
+
+        Node *	parent ( void ) const
+        {   return (reinterpret_cast<Node *>(parent_color & ~static_cast<std::size_t>(1)));   }
+
+        bool	color ( void ) const	{   return (parent_color & 1);   }
+
+        void	setParent ( Node *p )
+        {   parent_color = reinterpret_cast<std::size_t>(p) | (parent_color & 1);   }
+
+        void	setColor ( bool c )
+        {   parent_color = (parent_color & ~static_cast<std::size_t>(1)) | (c ? 1 : 0);   }
+
+        // The header is the only red node whose grandparent is itself (the
+        // root's parent is the header and vice versa); an empty tree's header
+        // has no parent at all.
+        bool	isHeader ( void ) const
+        {
+            Node *p = parent();
+            return (!p || (color() == RED && p->parent() == this));
+        }
+    };
+
     template < class T > 
-    struct		node
+    struct		node : node_links< node<T> >
     {
         typedef T value_type;
         T                   	data;
-        struct node *			left;
-        struct node *			right;
-        struct node *			parent;
-        bool 					nil;
-        bool					color;
-
-        node (T data) : data(data),left(0), 
-                right(0), parent (0), nil( true ), color( BLACK ) 
-                {}
+
+        node (const T & data) : node_links< node<T> >(), data(data) {}
        
-        node ( void )    :   data(0), left(0), 
-                right(0), parent (0), nil(true), color( BLACK ) {}
+        node ( void )    :   node_links< node<T> >(), data() {}
         
         // node&	operator=( const node& other )
         // {
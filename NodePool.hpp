@@ -0,0 +1,148 @@
+#ifndef NODE_POOL_HPP
+# define NODE_POOL_HPP
+
+# include <cstddef>
+# include "equal.hpp"
+
+namespace ft {
+
+	// Hands out node-sized blocks carved from slabs obtained through Alloc (the
+	// container's allocator parameter), so a tree pays one allocator call per
+	// slab instead of one per node. Released blocks go on an intrusive free
+	// list and are handed out again first. Slabs start at a single node and
+	// double from there. They stay until the owner calls release() (on clear()
+	// and destruction), so capacity reserved up front survives the container
+	// emptying out, and a container going between 0 and 1 elements does not
+	// hit Alloc each time. The pool itself is one pointer: its free list and
+	// counters live at the head of the first slab, and Alloc is a base so a
+	// stateless allocator adds nothing.
+	template < class Node, class Alloc >
+	class node_pool : private Alloc
+	{
+		public:
+			typedef Alloc									allocator_type;
+			typedef std::size_t								size_type;
+
+		private:
+			// The first blocks of every slab chain the slabs together: the first
+			// slab links to the newest one, which links to the one before it. Only
+			// the first slab's free_list and live are used.
+			struct slab_head	{	Node * next; size_type count; Node * free_list; size_type live;	};
+			// a free block only holds the link to the next free block
+			struct free_link	{	Node * next;	};
+
+			enum { HEAD = (sizeof(slab_head) + sizeof(Node) - 1) / sizeof(Node), MAX_SLAB = 4096 };
+
+			Node *				slabs;
+
+			node_pool (const node_pool &);
+			node_pool & operator= (const node_pool &);
+
+			static free_link *	freeLink (Node *p)	{	return reinterpret_cast<free_link *>(p);	}
+			static slab_head *	slabHead (Node *p)	{	return reinterpret_cast<slab_head *>(p);	}
+
+			void push (Node *p)
+			{
+				freeLink(p)->next = slabHead(slabs)->free_list;
+				slabHead(slabs)->free_list = p;
+			}
+
+			// each slab twice the newest one, up to MAX_SLAB blocks
+			size_type nextSlab () const
+			{
+				if (!slabs)
+					return (1);
+				Node *newest = slabHead(slabs)->next ? slabHead(slabs)->next : slabs;
+				size_type n = 2 * (slabHead(newest)->count - HEAD);
+				return (n > MAX_SLAB ? static_cast<size_type>(MAX_SLAB) : n);
+			}
+
+			void grow (size_type n)
+			{
+				Node *s = Alloc::allocate(n + HEAD);
+				slabHead(s)->count = n + HEAD;
+				if (slabs)
+				{
+					slabHead(s)->next = slabHead(slabs)->next;
+					slabHead(slabs)->next = s;
+				}
+				else
+				{
+					slabHead(s)->next = NULL;
+					slabHead(s)->free_list = NULL;
+					slabHead(s)->live = 0;
+					slabs = s;
+				}
+				for (size_type i = n + HEAD - 1; i >= HEAD; i--)	// hand the slab out in address order
+					push(s + i);
+			}
+
+		public:
+			explicit node_pool (const allocator_type & a = allocator_type())	:
+				Alloc(a), slabs(NULL) {}
+
+			~node_pool ()	{	release();	}
+
+			Node * allocate ()
+			{
+				if (!slabs || !slabHead(slabs)->free_list)
+					grow(nextSlab());
+				slab_head *h = slabHead(slabs);
+				Node *p = h->free_list;
+				h->free_list = freeLink(p)->next;
+				h->live++;
+				return p;
+			}
+
+			void deallocate (Node *p)
+			{
+				push(p);
+				slabHead(slabs)->live--;
+			}
+
+			// gives every slab back to Alloc; no block may be in use any more
+			void release ()
+			{
+				while (slabs)
+				{
+					Node *next = slabHead(slabs)->next;
+					Alloc::deallocate(slabs, slabHead(slabs)->count);
+					slabs = next;
+				}
+			}
+
+			// makes sure n more blocks can be handed out without touching Alloc
+			void reserve (size_type n)
+			{
+				size_type available = capacity();
+				if (n > available)
+					grow(n - available);
+			}
+
+			// blocks handed out and not yet given back; the tree owns exactly
+			// these, so it doubles as the container's size
+			size_type size () const	{	return (slabs ? slabHead(slabs)->live : 0);	}
+
+			// blocks that can be handed out without touching Alloc
+			size_type capacity () const
+			{
+				if (!slabs)
+					return (0);
+				size_type n = 0;
+				for (Node *s = slabs; s; s = slabHead(s)->next)
+					n += slabHead(s)->count - HEAD;
+				return (n - slabHead(slabs)->live);
+			}
+
+			allocator_type &		get_allocator ()		{	return *this;	}
+			const allocator_type &	get_allocator () const	{	return *this;	}
+
+			void swap (node_pool & x)
+			{
+				ft::swap(get_allocator(), x.get_allocator());
+				ft::swap(slabs, x.slabs);
+			}
+	};
+}
+
+#endif
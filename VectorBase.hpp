@@ -0,0 +1,952 @@
+#ifndef VECTOR_BASE_HPP
+# define VECTOR_BASE_HPP
+
+# include "Iterator.hpp"
+# include "iterator_traits.hpp"
+# include "equal.hpp"
+# include "GrowthPolicy.hpp"
+# include "AllocatorTraits.hpp"
+# include "Debug.hpp"
+
+# include <memory>
+# include <algorithm>
+# include <stdexcept>
+# include <cstring>
+# include <iterator>
+# include <utility>
+
+    namespace   ft {
+
+    // iterators walking a plain array of T, which bulk copies may treat as bytes
+    template <class It, class T> struct is_contiguous_iterator				: public false_type	{};
+    template <class T> struct is_contiguous_iterator<T*, T>					: public true_type	{};
+    template <class T> struct is_contiguous_iterator<const T*, T>			: public true_type	{};
+    template <class T> struct is_contiguous_iterator<ft::iterator<T>, T>		: public true_type	{};
+    template <class T> struct is_contiguous_iterator<ft::iterator<const T>, T>	: public true_type	{};
+
+    // Raw room for N elements inside the object, aligned for anything T could
+    // need. With N == 0 there is none and inlineData() is NULL.
+    template <typename T, std::size_t N>
+    class inline_buffer {
+
+            union storage {
+                char            bytes[N * sizeof(T)];
+                long double     align_ld;
+                double          align_d;
+                long            align_l;
+                void *          align_p;
+            };
+
+            storage _inline;
+
+        protected :
+            T *inlineData()                { return reinterpret_cast<T *>(_inline.bytes); }
+            const T *inlineData() const    { return reinterpret_cast<const T *>(_inline.bytes); }
+    };
+
+    template <typename T>
+    class inline_buffer<T, 0> {
+
+        protected :
+            T *inlineData() const   { return NULL; }
+    };
+
+    // What ft::vector and ft::small_vector share: the buffer (arr, _size and
+    // _capacity), the allocator, the growth policy and every algorithm on
+    // them. They differ in where the elements of a small one live: the first
+    // N slots are inside the object for small_vector, vector has N == 0 and
+    // no buffer at all until it grows. The containers inherit privately and
+    // pick the members they offer with using-declarations.
+    template<typename T, typename A, typename G, std::size_t N = 0>
+    class vector_base : private ft::ebo_store<G>, protected ft::debug_owner, private ft::inline_buffer<T, N> {
+
+        protected :
+            typedef	T														value_type;
+			typedef A   													allocator_type;
+			typedef G														growth_policy_type;
+			typedef typename allocator_type::reference						reference;
+			typedef typename allocator_type::const_reference				const_reference;
+			typedef ft::iterator< T >										iterator;
+			typedef ft::iterator< const T >									const_iterator;
+			typedef ft::reverse_iterator<iterator>							reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+			typedef size_t													size_type;
+
+            typedef ft::ebo_store<G>                                        growth_base;
+            typedef ft::inline_buffer<T, N>                                 inline_base;
+            using inline_base::inlineData;
+
+            A   _alloc;
+            size_type _capacity;
+            value_type *arr;
+            size_type _size;
+
+            // Elements may be copied / relocated as raw bytes and their
+            // destructors skipped. Only with allocators whose construct and
+            // destroy have no side effects (ft::allocator_ext).
+            typedef ft::integral_constant<bool, ft::is_trivially_copyable<T>::value
+                        && ft::allocator_ext<A>::plain_construct>			trivial_copy;
+            typedef ft::integral_constant<bool, ft::is_trivially_relocatable<T>::value
+                        && ft::allocator_ext<A>::plain_construct>			trivial_relocate;
+            // new elements may be left as the allocator hands the memory out
+            typedef ft::integral_constant<bool, ft::is_trivially_default_constructible<T>::value
+                        && ft::allocator_ext<A>::plain_construct>			trivial_default_init;
+            // the buffer may be resized by the allocator, keeping its bytes
+            typedef ft::integral_constant<bool, trivial_relocate::value
+                        && ft::allocator_ext<A>::can_reallocate>				in_place_growth;
+
+            explicit vector_base( const A& alloc, const G& growth = G() )  :
+                growth_base(growth), _alloc(alloc), _capacity(N), arr(inlineData()), _size(0)   {}
+
+            ~vector_base()
+            {
+                destroyRange(arr, arr + _size);
+                releaseBuffer(arr, _capacity);
+            }
+
+        private :
+            vector_base( const vector_base& );
+            vector_base& operator = ( const vector_base& );
+
+        protected :
+# if __cplusplus >= 201103L
+            template <class... Args>
+            void constructAt(value_type *p, Args&&... args)
+            {   std::allocator_traits<A>::construct(_alloc, p, std::forward<Args>(args)...);   }
+
+            void destroyAt(value_type *p)   {   std::allocator_traits<A>::destroy(_alloc, p);   }
+# else
+            void constructAt(value_type *p, const value_type& val)  {   _alloc.construct(p, val);   }
+
+            void destroyAt(value_type *p)   {   _alloc.destroy(p);  }
+# endif
+
+            void destroyRange(value_type *first, value_type *last)
+            {
+                if (trivial_copy::value)
+                    return ;
+                for (; first != last; ++first)
+                    destroyAt(first);
+            }
+
+            // Shifting elements around inside the buffer: moves since C++11,
+            // copies before.
+            static value_type *shiftDown(value_type *first, value_type *last, value_type *dst)
+            {
+# if __cplusplus >= 201103L
+                return (std::move(first, last, dst));
+# else
+                return (std::copy(first, last, dst));
+# endif
+            }
+
+            static value_type *shiftUp(value_type *first, value_type *last, value_type *dst_last)
+            {
+# if __cplusplus >= 201103L
+                return (std::move_backward(first, last, dst_last));
+# else
+                return (std::copy_backward(first, last, dst_last));
+# endif
+            }
+
+            // into raw memory at dst: moves since C++11 (the source stays alive,
+            // moved from), copies before
+            value_type *uninitializedMove(value_type *first, value_type *last, value_type *dst)
+            {
+# if __cplusplus >= 201103L
+                return (uninitializedCopy(std::make_move_iterator(first), std::make_move_iterator(last), dst));
+# else
+                return (uninitializedCopy(first, last, dst));
+# endif
+            }
+
+            // like uninitializedMove, but only moves when that cannot throw, so
+            // a reallocation can still be undone by dropping the copies
+            value_type *uninitializedRelocate(value_type *first, value_type *last, value_type *dst)
+            {
+# if __cplusplus >= 201103L
+                value_type *cur = dst;
+                try {
+                    for (; first != last; ++first, ++cur)
+                        constructAt(cur, std::move_if_noexcept(*first));
+                } catch (...) {
+                    destroyRange(dst, cur);
+                    throw;
+                }
+                return cur;
+# else
+                return (uninitializedCopy(first, last, dst));
+# endif
+            }
+
+            // memmove, so the ranges may overlap
+            static void moveBytes(value_type *dst, const value_type *src, size_type n)
+            {
+                if (n > 0)
+                    std::memmove(static_cast<void *>(dst), static_cast<const void *>(src), n * sizeof(value_type));
+            }
+
+            // construct into raw memory at dst; if a copy throws, the ones
+            // already made are destroyed before rethrowing
+            template <class InputIterator>
+            value_type *uninitializedCopy(InputIterator first, InputIterator last, value_type *dst)
+            {
+                return (uninitializedCopy(first, last, dst, ft::integral_constant<bool, trivial_copy::value
+                            && ft::is_contiguous_iterator<InputIterator, T>::value>()));
+            }
+
+            template <class InputIterator>
+            value_type *uninitializedCopy(InputIterator first, InputIterator last, value_type *dst, ft::true_type)
+            {
+                size_type n = last - first;
+                if (n > 0)
+                    moveBytes(dst, &*first, n);
+                return (dst + n);
+            }
+
+            template <class InputIterator>
+            value_type *uninitializedCopy(InputIterator first, InputIterator last, value_type *dst, ft::false_type)
+            {
+                value_type *cur = dst;
+                try {
+                    for (; first != last; ++first, ++cur)
+                        constructAt(cur, *first);
+                } catch (...) {
+                    destroyRange(dst, cur);
+                    throw;
+                }
+                return cur;
+            }
+
+            // n copies of a trivially copyable val: one memset when all its bytes
+            // are the same (zeroes, -1, chars), else plain stores four at a time
+            static void fillTrivial(value_type *dst, size_type n, const value_type& val)
+            {
+                const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&val);
+                size_type i = 1;
+                while (i < sizeof(value_type) && bytes[i] == bytes[0])
+                    i++;
+                if (i == sizeof(value_type))
+                {
+                    if (n > 0)
+                        std::memset(static_cast<void *>(dst), bytes[0], n * sizeof(value_type));
+                    return;
+                }
+                value_type copy(val);
+                for (; n >= 4; n -= 4, dst += 4)
+                {
+                    dst[0] = copy;
+                    dst[1] = copy;
+                    dst[2] = copy;
+                    dst[3] = copy;
+                }
+                for (; n > 0; --n, ++dst)
+                    *dst = copy;
+            }
+
+            // fill constructor, resize, assign and insert all go through here
+            value_type *uninitializedFill(value_type *dst, size_type n, const value_type& val)
+            {
+                if (trivial_copy::value)
+                {
+                    fillTrivial(dst, n, val);
+                    return (dst + n);
+                }
+                value_type *cur = dst;
+                try {
+                    for (; n > 0; --n, ++cur)
+                        constructAt(cur, val);
+                } catch (...) {
+                    destroyRange(dst, cur);
+                    throw;
+                }
+                return cur;
+            }
+
+            // true while the elements live inside the object (never when N == 0)
+            bool isInline() const   { return (N != 0 && arr == inlineData()); }
+
+            // the inline buffer, or none at all, is not the allocator's to free
+            void releaseBuffer(value_type *buf, size_type cap)
+            {
+                if (cap > 0 && buf != inlineData())
+                    _alloc.deallocate(buf, cap);
+            }
+
+            value_type *allocateBuffer(size_type cap)
+            {
+                if (cap > max_size())
+                    throw std::length_error("vector:_Maximum_size_out");
+                return (_alloc.allocate(cap));
+            }
+
+            // room for n more elements, as the growth policy sees fit
+            size_type increasingCapacity(size_type n) {
+                if (n + _size <= _capacity)
+                    return _capacity;
+                size_type cap = growth_policy()(_capacity, n + _size, sizeof(value_type));
+                if (cap > max_size() && n + _size <= max_size())
+                    cap = max_size();
+                return (cap);
+            }
+
+            // Lets the allocator resize the buffer to new_cap (mremap and the
+            // like), the elements carried along as bytes. False when it cannot,
+            // and the caller allocates and copies as usual. The buffer may move,
+            // so references into it must be dealt with first.
+            bool reallocateInPlace(size_type new_cap)
+            {
+                if (!in_place_growth::value || _capacity == 0 || isInline())
+                    return (false);
+                value_type *p = ft::allocator_ext<A>::reallocate(_alloc, arr, _capacity, new_cap);
+                if (p == NULL)
+                    return (false);
+                growth_policy().reallocated(_capacity, new_cap, 0);
+                debugInvalidateAll();
+                arr = p;
+                _capacity = new_cap;
+                return (true);
+            }
+
+            // tmp (new_cap slots, possibly the inline buffer) already holds n
+            // new elements at idx: bring the current ones over around them and
+            // make tmp the buffer. On a throw tmp is released and *this is left
+            // as it was.
+            void adoptAround(value_type *tmp, size_type new_cap, size_type idx, size_type n)
+            {
+                if (trivial_relocate::value)
+                {
+                    moveBytes(tmp, arr, idx);
+                    moveBytes(tmp + idx + n, arr + idx, _size - idx);
+                }
+                else
+                {
+                    value_type *cur = tmp;
+                    try {
+                        cur = uninitializedRelocate(arr, arr + idx, tmp);
+                        uninitializedRelocate(arr + idx, arr + _size, tmp + idx + n);
+                    } catch (...) {
+                        destroyRange(tmp, cur);
+                        destroyRange(tmp + idx, tmp + idx + n);
+                        releaseBuffer(tmp, new_cap);
+                        throw;
+                    }
+                    destroyRange(arr, arr + _size);
+                }
+                releaseBuffer(arr, _capacity);
+                growth_policy().reallocated(_capacity, new_cap, _size * sizeof(value_type));
+                debugInvalidateAll();
+                arr = tmp;
+                _capacity = new_cap;
+                _size += n;
+            }
+
+            // exactly new_cap slots (at least _size); the inline buffer when
+            // they fit there, which for vector means no buffer at all
+            void reallocateTo(size_type new_cap)
+            {
+                if (new_cap > N)
+                    adoptAround(allocateBuffer(new_cap), new_cap, _size, 0);
+                else if (_size > 0)
+                    adoptAround(inlineData(), N, _size, 0);
+                else
+                {
+                    debugInvalidateAll();
+                    releaseBuffer(arr, _capacity);
+                    arr = inlineData();
+                    _capacity = N;
+                }
+            }
+
+            // clear() without giving the policy a chance to shrink
+            void dropElements()
+            {
+                debugInvalidateAll();
+                destroyRange(arr, arr + _size);
+                _size = 0;
+            }
+
+            // drops the elements from n on (n <= _size)
+            void truncate(size_type n)
+            {
+                debugInvalidateFrom(arr + n);
+                destroyRange(arr + n, arr + _size);
+                _size = n;
+            }
+
+            // after clear(): lets the growth policy take memory back. Never run
+            // by erase, which must keep iterators before the erased range valid.
+            // Only an optimisation, so a failed allocation keeps the buffer.
+            void shrinkIfSparse()
+            {
+                size_type cap = growth_policy().shrink(_capacity, _size);
+                if (cap >= _capacity || cap < _size)
+                    return;
+                try { reallocateTo(cap); }
+                catch (...) {}
+            }
+
+            template <class InputIterator>
+            void rangeAssign(InputIterator first, InputIterator last, std::input_iterator_tag)
+            {
+                dropElements();
+                for (; first != last; ++first)
+                    push_back(*first);
+            }
+
+            // Reuses the buffer when it is big enough: the common prefix is
+            // assigned over (so the range may come from this vector), only the
+            // size difference is constructed or destroyed. Otherwise allocates
+            // exactly the range's length.
+            template <class ForwardIterator>
+            void rangeAssign(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+            {
+                size_type n = ft::distance(first, last);
+                if (n > _capacity)
+                {
+                    value_type *tmp = allocateBuffer(n);
+                    try { uninitializedCopy(first, last, tmp); }
+                    catch (...) { _alloc.deallocate(tmp, n); throw; }
+                    growth_policy().reallocated(_capacity, n, 0);
+                    dropElements();
+                    releaseBuffer(arr, _capacity);
+                    arr = tmp;
+                    _capacity = n;
+                    _size = n;
+                    return;
+                }
+                value_type *cur = arr;
+                if (!trivial_copy::value)   // trivial ones are simply copied over below
+                    for (; first != last && cur != arr + _size; ++first, ++cur)
+                        *cur = *first;
+                uninitializedCopy(first, last, cur);
+                debugInvalidateAll();
+                if (n < _size)
+                    destroyRange(arr + n, arr + _size);
+                _size = n;
+            }
+
+            // copy assignment: x's allocator comes along when it differs
+            void assignFrom(const vector_base& x)
+            {
+                if (!(_alloc == x._alloc))
+                {
+                    dropElements();
+                    reallocateTo(0);
+                    _alloc = x._alloc;
+                }
+                rangeAssign(x.arr, x.arr + x._size, std::forward_iterator_tag());
+            }
+
+            void swapBuffers(vector_base& x)
+            {
+                ft::swap(_alloc, x._alloc);
+                ft::swap(_capacity, x._capacity);
+                ft::swap(arr, x.arr);
+                ft::swap(_size, x._size);
+                ft::swap(growth_policy(), x.growth_policy());
+                debugSwap(x);
+            }
+
+# if __cplusplus >= 201103L
+            // a heap buffer is taken over; inline elements have to be moved
+            void moveConstruct(vector_base& x)
+            {
+                if (x.isInline())
+                {
+                    uninitializedMove(x.arr, x.arr + x._size, arr);
+                    _size = x._size;
+                    return;
+                }
+                arr = x.arr;
+                _capacity = x._capacity;
+                _size = x._size;
+                x.arr = x.inlineData();
+                x._capacity = N;
+                x._size = 0;
+                debugSwap(x);
+            }
+
+            // takes x's heap buffer when the allocators can free each other's
+            // memory, otherwise moves the elements one by one
+            void moveAssign(vector_base& x)
+            {
+                if (x.isInline() || !(_alloc == x._alloc))
+                {
+                    assign(std::make_move_iterator(x.arr), std::make_move_iterator(x.arr + x._size));
+                    return;
+                }
+                dropElements();
+                reallocateTo(0);
+                moveConstruct(x);
+            }
+# endif
+
+# ifdef FT_DEBUG
+            // what the checked iterators (Debug.hpp) ask about a position
+            bool debugDereferenceable(const void *pos) const
+            {   return (!std::less<const void *>()(pos, arr) && std::less<const void *>()(pos, arr + _size));  }
+
+            bool debugDecrementable(const void *pos) const
+            {   return (std::less<const void *>()(arr, pos) && !std::less<const void *>()(arr + _size, pos));  }
+# endif
+
+            // single pass iterators can only be taken one element at a time
+            template <class InputIterator>
+            void rangeInsert(iterator position, InputIterator first, InputIterator last, std::input_iterator_tag)
+            {
+                debugOwns(position);
+                for (; first != last; ++first)
+                    position = insert(position, *first) + 1;
+            }
+
+            template <class ForwardIterator>
+            void rangeInsert(iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+            {
+                size_type dist = ft::distance(first, last);
+                if (dist == 0)
+                    return ;
+                debugOwns(position);
+                size_type idx = position.base() - arr;
+                debugInvalidateFrom(arr + idx);
+                if (_size + dist <= _capacity && trivial_relocate::value)
+                {
+                    value_type *pos = arr + idx;
+                    moveBytes(pos + dist, pos, _size - idx);
+                    try { uninitializedCopy(first, last, pos); }
+                    catch (...) { moveBytes(pos, pos + dist, _size - idx); throw; }
+                    _size += dist;
+                    return;
+                }
+                if (_size + dist <= _capacity)
+                {
+                    value_type *pos = arr + idx;
+                    value_type *old_end = arr + _size;
+                    size_type after = _size - idx;
+                    if (after > dist)
+                    {
+                        uninitializedMove(old_end - dist, old_end, old_end);
+                        _size += dist;
+                        shiftUp(pos, old_end - dist, old_end);
+                        for (; first != last; ++first, ++pos)
+                            *pos = *first;
+                    }
+                    else
+                    {
+                        ForwardIterator mid = first;
+                        for (size_type i = 0; i < after; i++)
+                            ++mid;
+                        uninitializedCopy(mid, last, old_end);
+                        _size += dist - after;
+                        uninitializedMove(pos, old_end, arr + _size);
+                        _size += after;
+                        for (; first != mid; ++first, ++pos)
+                            *pos = *first;
+                    }
+                    return;
+                }
+                size_type new_cap = increasingCapacity(dist);
+                value_type *tmp = allocateBuffer(new_cap);
+                try { uninitializedCopy(first, last, tmp + idx); }
+                catch (...) { _alloc.deallocate(tmp, new_cap); throw; }
+                adoptAround(tmp, new_cap, idx, dist);
+            }
+
+        public :
+// Element access:--------------------------------------------------------------
+        // unchecked, at() is the checked one (and FT_DEBUG, see Debug.hpp)
+        T &operator[](size_type index){
+            FT_ASSERT(index < _size, "vector::operator[] out of range");
+            return (arr[index]);
+        }
+
+        const T &operator[] (size_type index) const {
+            FT_ASSERT(index < _size, "vector::operator[] out of range");
+            return (arr[index]);
+        }
+
+        T &at (size_type n)
+        {
+            if (n >= _size)
+                throw std::out_of_range("_M_range_check");
+            return *(arr + n);
+        }
+
+        const T &at (size_type n) const
+        {
+            if (n >= _size)
+                throw std::out_of_range("_M_range_check");
+            return *(arr + n);
+        }
+
+        T& front()  {
+            FT_ASSERT(!empty(), "vector::front() on an empty vector");
+            return *arr;
+        }
+
+        const T& front() const  {
+            FT_ASSERT(!empty(), "vector::front() on an empty vector");
+            return *arr;
+        }
+
+        T& back()  {
+            FT_ASSERT(!empty(), "vector::back() on an empty vector");
+            return *(arr + _size - 1);
+        }
+
+        const T& back() const   {
+            FT_ASSERT(!empty(), "vector::back() on an empty vector");
+            return *(arr + _size - 1);
+        }
+
+        T* data()                   {   return arr; }
+        const T* data() const       {   return arr; }
+
+//==============================================================================
+
+// Capacity:--------------------------------------------------------------------
+
+        size_type size() const { return (_size); }
+
+# if __cplusplus >= 201103L
+        size_type max_size() const { return std::allocator_traits<A>::max_size(_alloc); }
+# else
+        size_type max_size() const { return _alloc.max_size(); }
+# endif
+
+        void resize (size_type n, const value_type& val = value_type())
+        {
+            if (n <= _size)
+            {
+                truncate(n);
+                return;
+            }
+            debugInvalidateFrom(arr + _size);
+            if (n > _capacity)
+            {
+                value_type copy(val);   // val may be one of the elements
+                reserve(increasingCapacity(n - _size));
+                uninitializedFill(arr + _size, n - _size, copy);
+            }
+            else
+                uninitializedFill(arr + _size, n - _size, val);
+            _size = n;
+        }
+
+        size_type capacity() const { return (_capacity); }
+
+        bool empty() const  { return (_size == 0); }
+
+        void reserve( size_type new_cap ) {
+            if (new_cap <= _capacity)
+                return;
+            if (new_cap > max_size())
+                throw std::length_error("_Maximum_size_out");
+            if (reallocateInPlace(new_cap))
+                return;
+            adoptAround(allocateBuffer(new_cap), new_cap, _size, 0);
+        }
+
+        // Reallocates to exactly size(), or back to the inline buffer when
+        // the elements fit there; trivially relocatable elements are moved
+        // over with memcpy.
+        void shrink_to_fit() {
+            if (!isInline() && _size < _capacity)
+                reallocateTo(_size);
+        }
+
+//==============================================================================
+
+// Modifiers:-------------------------------------------------------------------
+        template <class InputIterator>
+		void		assign( InputIterator first, InputIterator last,
+							typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0 )
+        {   rangeAssign(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());  }
+
+        void assign (size_type n, const value_type& val)
+        {
+            value_type copy(val);   // val may be one of the elements
+            dropElements();
+            reserve(n);
+            uninitializedFill(arr, n, copy);
+            _size = n;
+        }
+
+        // when growing, the new element is built before the old ones move, so
+        // elem may refer into this vector
+        void push_back(const value_type& elem) {
+            if (_size < _capacity)
+            {
+                debugInvalidateFrom(arr + _size);
+                constructAt(arr + _size, elem);
+                _size++;
+                return;
+            }
+            size_type new_cap = increasingCapacity(1);
+            if (in_place_growth::value)
+            {
+                value_type copy(elem);
+                if (reallocateInPlace(new_cap))
+                {
+                    constructAt(arr + _size, copy);
+                    _size++;
+                    return;
+                }
+            }
+            value_type *tmp = allocateBuffer(new_cap);
+            try { constructAt(tmp + _size, elem); }
+            catch (...) { _alloc.deallocate(tmp, new_cap); throw; }
+            adoptAround(tmp, new_cap, _size, 1);
+        }
+
+        void pop_back(void) {
+            if (_size > 0) {
+                debugInvalidateFrom(arr + _size - 1);
+                destroyAt(arr + _size - 1);
+                _size--;
+            }
+        }
+
+# if __cplusplus >= 201103L
+        void push_back(value_type&& elem)   {   emplace_back(std::move(elem));  }
+
+        template <class... Args>
+        reference emplace_back(Args&&... args) {
+            if (_size < _capacity)
+            {
+                debugInvalidateFrom(arr + _size);
+                constructAt(arr + _size, std::forward<Args>(args)...);
+                _size++;
+                return (back());
+            }
+            size_type new_cap = increasingCapacity(1);
+            if (in_place_growth::value)
+            {
+                value_type val(std::forward<Args>(args)...);    // args may refer into the buffer
+                if (reallocateInPlace(new_cap))
+                {
+                    constructAt(arr + _size, std::move(val));
+                    _size++;
+                    return (back());
+                }
+                value_type *tmp = allocateBuffer(new_cap);
+                try { constructAt(tmp + _size, std::move(val)); }
+                catch (...) { _alloc.deallocate(tmp, new_cap); throw; }
+                adoptAround(tmp, new_cap, _size, 1);
+                return (back());
+            }
+            value_type *tmp = allocateBuffer(new_cap);
+            try { constructAt(tmp + _size, std::forward<Args>(args)...); }
+            catch (...) { _alloc.deallocate(tmp, new_cap); throw; }
+            adoptAround(tmp, new_cap, _size, 1);
+            return (back());
+        }
+
+        template <class... Args>
+        iterator emplace(iterator position, Args&&... args) {
+            debugOwns(position);
+            size_type idx = position.base() - arr;
+            if (idx == _size)
+            {
+                emplace_back(std::forward<Args>(args)...);
+                return (iterator(arr + idx, this));
+            }
+            if (_size == _capacity)
+            {
+                size_type new_cap = increasingCapacity(1);
+                value_type *tmp = allocateBuffer(new_cap);
+                try { constructAt(tmp + idx, std::forward<Args>(args)...); }
+                catch (...) { _alloc.deallocate(tmp, new_cap); throw; }
+                adoptAround(tmp, new_cap, idx, 1);
+                return (iterator(arr + idx, this));
+            }
+            value_type val(std::forward<Args>(args)...);    // args may refer into the vector
+            debugInvalidateFrom(arr + idx);
+            constructAt(arr + _size, std::move(arr[_size - 1]));
+            _size++;
+            shiftUp(arr + idx, arr + _size - 2, arr + _size - 1);
+            arr[idx] = std::move(val);
+            return (iterator(arr + idx, this));
+        }
+
+        iterator insert (iterator position, value_type&& val)  {   return (emplace(position, std::move(val)));    }
+# endif
+
+        iterator insert (iterator position, const T& val) {
+            debugOwns(position);
+            size_type i = position.base() - arr;
+            insert(position, 1, val);
+            return (iterator(arr + i, this));
+        }
+
+        // Fits in the current buffer: the tail is shifted back in place and
+        // the gap filled. Otherwise one new buffer is filled in order.
+        void insert (iterator position, size_type n, const T& val)
+        {
+            debugOwns(position);
+            if (n == 0)
+                return;
+            size_type idx = position.base() - arr;
+            debugInvalidateFrom(arr + idx);
+            if (_size + n <= _capacity && trivial_relocate::value)
+            {
+                value_type copy(val);   // val may sit in the part being shifted
+                value_type *pos = arr + idx;
+                moveBytes(pos + n, pos, _size - idx);
+                try { uninitializedFill(pos, n, copy); }
+                catch (...) { moveBytes(pos, pos + n, _size - idx); throw; }
+                _size += n;
+                return;
+            }
+            if (_size + n <= _capacity)
+            {
+                value_type copy(val);   // val may sit in the part being shifted
+                value_type *pos = arr + idx;
+                value_type *old_end = arr + _size;
+                size_type after = _size - idx;
+                if (after > n)
+                {
+                    uninitializedMove(old_end - n, old_end, old_end);
+                    _size += n;
+                    shiftUp(pos, old_end - n, old_end);
+                    std::fill(pos, pos + n, copy);
+                }
+                else
+                {
+                    uninitializedFill(old_end, n - after, copy);
+                    _size += n - after;
+                    uninitializedMove(pos, old_end, arr + _size);
+                    _size += after;
+                    std::fill(pos, old_end, copy);
+                }
+                return;
+            }
+            size_type new_cap = increasingCapacity(n);
+            if (new_cap > max_size())
+                throw std::length_error("vector:_Maximum_size_out");
+            if (in_place_growth::value)
+            {
+                value_type copy(val);
+                if (reallocateInPlace(new_cap))
+                {
+                    insert(iterator(arr + idx, this), n, copy);
+                    return;
+                }
+            }
+            value_type *tmp = allocateBuffer(new_cap);
+            try { uninitializedFill(tmp + idx, n, val); }
+            catch (...) { _alloc.deallocate(tmp, new_cap); throw; }
+            adoptAround(tmp, new_cap, idx, n);
+        }
+
+        template <class InputIterator>
+			void	insert( iterator position, InputIterator first, InputIterator last,
+							typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
+        {   rangeInsert(position, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());    }
+
+        iterator erase (iterator position) {
+            position.debugDereferenceable();
+            return erase(position, position + 1);
+        }
+
+        iterator erase (iterator first, iterator last)
+        {
+            debugOwns(first);
+            debugOwns(last);
+            size_type dist = ft::distance(first, last);
+            if (dist == 0)
+                return first;
+            size_type idx = first.base() - arr;
+            if (trivial_relocate::value)
+            {
+                destroyRange(first.base(), last.base());
+                moveBytes(first.base(), last.base(), (arr + _size) - last.base());
+            }
+            else
+            {
+                // shift the tail down by assignment, then drop the last dist slots
+                value_type *new_end = shiftDown(last.base(), arr + _size, first.base());
+                destroyRange(new_end, arr + _size);
+            }
+            _size -= dist;
+            debugInvalidateFrom(arr + idx);
+            return iterator(arr + idx, this);
+        }
+
+        // Removes every element pred holds for in one pass, keeping the order
+        // of the others; returns how many went away.
+        template <class Predicate>
+        size_type erase_if (Predicate pred)
+        {
+            value_type *first = std::find_if(arr, arr + _size, pred);
+            value_type *new_end = std::remove_if(first, arr + _size, pred);
+            size_type n = (arr + _size) - new_end;
+            debugInvalidateFrom(first);
+            destroyRange(new_end, arr + _size);
+            _size -= n;
+            return n;
+        }
+
+        void clear() {
+            dropElements();
+            shrinkIfSparse();
+        }
+
+ // ============================================================================
+
+// Iterators:-------------------------------------------------------------------
+        iterator                begin()         { return iterator(arr, this);                   };
+        iterator                end()           { return iterator(arr+_size, this);             };
+        const_iterator          begin() const   { return const_iterator(arr, this);             };
+        const_iterator          end() const     { return const_iterator (arr+_size, this);      };
+
+        reverse_iterator		rbegin() 		{   return reverse_iterator(end());		    };
+        const_reverse_iterator	rbegin() const  {	return const_reverse_iterator(end());	};
+        reverse_iterator		rend() 			{	return reverse_iterator(begin());		};
+        const_reverse_iterator	rend() const 	{	return const_reverse_iterator(begin());	};
+//==============================================================================
+
+// ALLOCATOR:-------------------------------------------------------------------
+			A get_allocator() const    { return _alloc; }
+//==============================================================================
+
+// GROWTH POLICY:---------------------------------------------------------------
+			growth_policy_type &		growth_policy()			{ return growth_base::get(); }
+			const growth_policy_type &	growth_policy() const	{ return growth_base::get(); }
+//==============================================================================
+    };
+
+    // The containers built on vector_base say so here and get the comparison
+    // operators below.
+    template <class V> struct is_vector_like : public false_type {};
+
+template <class V>
+	typename ft::enable_if<is_vector_like<V>::value, bool>::type	operator == (const V& l, const V& r)
+	{
+		if (l.size() != r.size())	return false;
+		return ft::equal(l.begin(), l.end(), r.begin());
+	};
+
+	template <class V>
+	typename ft::enable_if<is_vector_like<V>::value, bool>::type	operator != (const V& l, const V& r)
+    {	return !(l == r);		};
+
+	template <class V>
+	typename ft::enable_if<is_vector_like<V>::value, bool>::type	operator < (const V& l, const V& r)
+    {	return ft::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());		};
+
+	template <class V>
+	typename ft::enable_if<is_vector_like<V>::value, bool>::type	operator <= (const V& l, const V& r)
+    {	return !(r < l);		};
+
+	template <class V>
+	typename ft::enable_if<is_vector_like<V>::value, bool>::type	operator > (const V& l, const V& r)
+    {	return r < l;			};
+
+	template <class V>
+	typename ft::enable_if<is_vector_like<V>::value, bool>::type	operator >= (const V& l, const V& r)
+    {	return !(l < r);		};
+
+} // endnamespace ft
+
+#endif
@@ -0,0 +1,512 @@
+#ifndef VECTOR_BOOL_HPP
+# define VECTOR_BOOL_HPP
+
+# include "vector.hpp"
+# include "IteratorBit.hpp"
+
+    namespace   ft {
+
+    // ft::vector<bool> keeps 64 flags per word, bit i in bit i % 64 of word
+    // i / 64: an eighth of the memory of a byte per flag. operator[] and the
+    // iterators give out a BitReference proxy rather than a bool &. The bits
+    // past size() in the last word are always zero, so count(), find_first(),
+    // flip(), the bitwise operators, == and < go a word at a time. The words
+    // are a plain ft::vector, which allocates them and follows the growth
+    // policy. Under FT_DEBUG operator[], front() and back() are checked, the
+    // iterators are not.
+    template<typename A, typename G>
+// class VECTOR<BOOL> **********************************************************
+    class vector<bool, A, G> {
+
+        public :
+            typedef	bool													value_type;
+			typedef A   													allocator_type;
+			typedef G														growth_policy_type;
+
+			typedef ft::BitReference										reference;
+			typedef bool													const_reference;
+			typedef ft::BitReference *										pointer;
+			typedef const bool *											const_pointer;
+
+			typedef ft::IteratorBit<false>									iterator;
+			typedef ft::IteratorBit<true>									const_iterator;
+			typedef ft::reverse_iterator<iterator>							reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+			typedef std::ptrdiff_t											difference_type;
+			typedef size_t													size_type;
+
+			typedef ft::bit_word											word_type;
+            static const size_type bits_per_word = ft::bit_word_bits;
+
+        private:
+            typedef typename A::template rebind<word_type>::other           word_allocator;
+            typedef ft::vector<word_type, word_allocator, G>                word_vector;
+
+            word_vector _words;
+            size_type _size;
+
+            static size_type wordsFor(size_type n)  {   return ((n + bits_per_word - 1) / bits_per_word);  }
+
+            // the bits below n % 64, all of them when n ends on a word
+            static word_type lowMask(size_type n)
+            {
+                n %= bits_per_word;
+                return (n ? (word_type(1) << n) - 1 : ~word_type(0));
+            }
+
+            // the popcnt instruction when the target has it, else bit tricks
+            // the compiler can vectorise (the builtin would be a libgcc call)
+            static size_type popcount(word_type w)
+            {
+# if defined(__GNUC__) && defined(__POPCNT__)
+                return (__builtin_popcountll(w));
+# else
+                w = w - ((w >> 1) & 0x5555555555555555ULL);
+                w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+                w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+                return ((w * 0x0101010101010101ULL) >> 56);
+# endif
+            }
+
+            // index of the lowest set bit of a non-zero word
+            static size_type lowestBit(word_type w)
+            {
+# if defined(__GNUC__)
+                return (__builtin_ctzll(w));
+# else
+                size_type n = 0;
+                for (; !(w & 1); w >>= 1)
+                    n++;
+                return (n);
+# endif
+            }
+
+            static void setMask(word_type &w, word_type mask, bool val)
+            {
+                if (val)
+                    w |= mask;
+                else
+                    w &= ~mask;
+            }
+
+            word_type *words()              {   return (_words.data());  }
+            const word_type *words() const  {   return (_words.data());  }
+
+            // words both vectors have; past x's size its bits are zero
+            size_type sharedWords(const vector &x) const
+            {
+                size_type mine = wordsFor(_size);
+                size_type theirs = wordsFor(x._size);
+                return (mine < theirs ? mine : theirs);
+            }
+
+            // keeps the bits past _size zero
+            void clearTail()
+            {
+                if (_size % bits_per_word)
+                    words()[_size / bits_per_word] &= lowMask(_size);
+            }
+
+            // sets the bits [first, last) to val, the whole words in between at once
+            void fillBits(size_type first, size_type last, bool val)
+            {
+                if (first >= last)
+                    return;
+                word_type *w = words();
+                size_type fw = first / bits_per_word;
+                size_type lw = (last - 1) / bits_per_word;
+                word_type head = ~word_type(0) << (first % bits_per_word);
+                if (fw == lw)
+                {
+                    setMask(w[fw], head & lowMask(last), val);
+                    return;
+                }
+                setMask(w[fw], head, val);
+                std::fill(w + fw + 1, w + lw, val ? ~word_type(0) : word_type(0));
+                setMask(w[lw], lowMask(last), val);
+            }
+
+            // n bits (n >= _size), the new ones val
+            void grow(size_type n, bool val)
+            {
+                if (n > max_size())
+                    throw std::length_error("_Maximum_size_out");
+                _words.resize(wordsFor(n), word_type(0));
+                size_type old = _size;
+                _size = n;
+                if (val)
+                    fillBits(old, n, true);
+            }
+
+            // drops the bits from n on (n <= _size)
+            void truncate(size_type n)
+            {
+                _words.resize(wordsFor(n));
+                _size = n;
+                clearTail();
+            }
+
+            // n zero bits at idx, the ones after it shifted up
+            void openGap(size_type idx, size_type n)
+            {
+                size_type old = _size;
+                grow(_size + n, false);
+                std::copy_backward(begin() + idx, begin() + old, begin() + old + n);
+                fillBits(idx, idx + n, false);
+            }
+
+            // the first set bit at or after i, size() if there is none
+            size_type findFrom(size_type i) const
+            {
+                if (i >= _size)
+                    return (_size);
+                const word_type *w = words();
+                size_type n = i / bits_per_word;
+                word_type cur = w[n] & (~word_type(0) << (i % bits_per_word));
+                size_type last = wordsFor(_size);
+                while (!cur)
+                {
+                    if (++n == last)
+                        return (_size);
+                    cur = w[n];
+                }
+                return (n * bits_per_word + lowestBit(cur));
+            }
+
+            template <class InputIterator>
+            void rangeInsert(size_type idx, InputIterator first, InputIterator last, std::input_iterator_tag)
+            {
+                for (; first != last; ++first, ++idx)
+                    insert(begin() + idx, bool(*first));
+            }
+
+            template <class ForwardIterator>
+            void rangeInsert(size_type idx, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+            {
+                size_type n = ft::distance(first, last);
+                if (n == 0)
+                    return;
+                openGap(idx, n);
+                for (iterator it = begin() + idx; first != last; ++first, ++it)
+                    *it = bool(*first);
+            }
+
+        public:
+// CONSTRUCTORS-------------------------------------------------------------------
+
+            explicit	vector( const allocator_type& alloc = allocator_type() )	:
+                        _words(word_allocator(alloc)), _size(0) {};
+
+			explicit	vector( size_type n, const value_type& val = value_type(),
+							const allocator_type& alloc = allocator_type() )    :
+                        _words(word_allocator(alloc)), _size(0)
+            {   grow(n, val);   };
+
+			template <class InputIterator>
+			vector( InputIterator first, InputIterator last,
+                const allocator_type& alloc = allocator_type(),
+                typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)	:
+                _words(word_allocator(alloc)), _size(0)
+            {   insert(end(), first, last);   };
+
+			vector( const vector& x )	:	_words(x._words), _size(x._size)    {};
+
+# if __cplusplus >= 201103L
+            vector( vector&& x ) noexcept : _words(std::move(x._words)), _size(x._size)
+            {   x._size = 0;    }
+
+            vector&					operator = (vector&& x)
+            {
+                if (this == &x)
+                    return *this;
+                _words = std::move(x._words);
+                _size = x._size;
+                x._size = 0;
+                return *this;
+            }
+# endif
+
+			vector&					operator = (const vector& x)
+			{
+                _words = x._words;
+                _size = x._size;
+				return *this;
+			}
+// DESTRUCTOR-------------------------------------------------------------------
+            ~vector()   {}
+
+// Element access:--------------------------------------------------------------
+        reference operator[](size_type index) {
+            FT_ASSERT(index < _size, "vector::operator[] out of range");
+            return (reference(words() + index / bits_per_word, word_type(1) << (index % bits_per_word)));
+        }
+
+        const_reference operator[](size_type index) const {
+            FT_ASSERT(index < _size, "vector::operator[] out of range");
+            return (((words()[index / bits_per_word] >> (index % bits_per_word)) & 1) != 0);
+        }
+
+        reference at (size_type n)
+        {
+            if (n >= _size)
+                throw std::out_of_range("_M_range_check");
+            return ((*this)[n]);
+        }
+
+        const_reference at (size_type n) const
+        {
+            if (n >= _size)
+                throw std::out_of_range("_M_range_check");
+            return ((*this)[n]);
+        }
+
+        reference front()  {
+            FT_ASSERT(!empty(), "vector::front() on an empty vector");
+            return ((*this)[0]);
+        }
+
+        const_reference front() const  {
+            FT_ASSERT(!empty(), "vector::front() on an empty vector");
+            return ((*this)[0]);
+        }
+
+        reference back()  {
+            FT_ASSERT(!empty(), "vector::back() on an empty vector");
+            return ((*this)[_size - 1]);
+        }
+
+        const_reference back() const   {
+            FT_ASSERT(!empty(), "vector::back() on an empty vector");
+            return ((*this)[_size - 1]);
+        }
+
+//==============================================================================
+
+// Capacity:--------------------------------------------------------------------
+
+        size_type size() const { return (_size); }
+
+        size_type max_size() const
+        {
+            size_type n = _words.max_size();
+            return (n > size_type(-1) / bits_per_word ? size_type(-1) : n * bits_per_word);
+        }
+
+        void resize (size_type n, const value_type& val = value_type())
+        {
+            if (n <= _size)
+                truncate(n);
+            else
+                grow(n, val);
+        }
+
+        size_type capacity() const { return (_words.capacity() * bits_per_word); }
+
+        bool empty() const  { return (_size == 0); }
+
+        void reserve( size_type new_cap ) {
+            if (new_cap > max_size())
+                throw std::length_error("_Maximum_size_out");
+            _words.reserve(wordsFor(new_cap));
+        }
+
+        void shrink_to_fit() { _words.shrink_to_fit(); }
+
+//==============================================================================
+
+// Bit operations:--------------------------------------------------------------
+        // number of true flags
+        size_type count() const
+        {
+            const word_type *w = words();
+            size_type n = 0;
+            for (size_type i = 0, last = wordsFor(_size); i < last; i++)
+                n += popcount(w[i]);
+            return (n);
+        }
+
+        // index of the first true flag, size() when there is none
+        size_type find_first() const    {   return (findFrom(0));   }
+
+        // index of the first true flag after pos, size() when there is none
+        size_type find_next(size_type pos) const    {   return (findFrom(pos + 1));    }
+
+        void flip()
+        {
+            word_type *w = words();
+            for (size_type i = 0, last = wordsFor(_size); i < last; i++)
+                w[i] = ~w[i];
+            clearTail();
+        }
+
+        // Element-wise; the size stays this one's. Where x is shorter its
+        // missing bits count as false, where it is longer the extra ones
+        // are ignored.
+        vector& operator &= (const vector& x)
+        {
+            word_type *w = words();
+            const word_type *xw = x.words();
+            size_type shared = sharedWords(x);
+            for (size_type i = 0; i < shared; i++)
+                w[i] &= xw[i];
+            std::fill(w + shared, w + wordsFor(_size), word_type(0));
+            return *this;
+        }
+
+        vector& operator |= (const vector& x)
+        {
+            word_type *w = words();
+            const word_type *xw = x.words();
+            for (size_type i = 0, last = sharedWords(x); i < last; i++)
+                w[i] |= xw[i];
+            clearTail();
+            return *this;
+        }
+
+        vector& operator ^= (const vector& x)
+        {
+            word_type *w = words();
+            const word_type *xw = x.words();
+            for (size_type i = 0, last = sharedWords(x); i < last; i++)
+                w[i] ^= xw[i];
+            clearTail();
+            return *this;
+        }
+
+//==============================================================================
+
+// Modifiers:-------------------------------------------------------------------
+        template <class InputIterator>
+		void		assign( InputIterator first, InputIterator last,
+							typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0 )
+        {
+            clear();
+            insert(end(), first, last);
+        }
+
+        void assign (size_type n, const value_type& val)
+        {
+            if (n > max_size())
+                throw std::length_error("_Maximum_size_out");
+            _words.assign(wordsFor(n), val ? ~word_type(0) : word_type(0));
+            _size = n;
+            clearTail();
+        }
+
+        void push_back(const value_type& x) {
+            if (_size % bits_per_word == 0)
+                _words.push_back(word_type(0));
+            if (x)
+                words()[_size / bits_per_word] |= word_type(1) << (_size % bits_per_word);
+            _size++;
+        }
+
+        void pop_back(void) {
+            if (_size > 0)
+                truncate(_size - 1);
+        }
+
+        iterator insert (iterator position, const value_type& val) {
+            size_type idx = position - begin();
+            insert(position, 1, val);
+            return (begin() + idx);
+        }
+
+        void insert (iterator position, size_type n, const value_type& val)
+        {
+            size_type idx = position - begin();
+            bool copy(val);     // val may be one of the flags
+            openGap(idx, n);
+            fillBits(idx, idx + n, copy);
+        }
+
+        template <class InputIterator>
+			void	insert( iterator position, InputIterator first, InputIterator last,
+							typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
+        {   rangeInsert(position - begin(), first, last, typename ft::iterator_traits<InputIterator>::iterator_category());    }
+
+        iterator erase (iterator position) {
+            return erase(position, position + 1);
+        }
+
+        iterator erase (iterator first, iterator last)
+        {
+            size_type idx = first - begin();
+            size_type n = last - first;
+            std::copy(last, end(), first);
+            truncate(_size - n);
+            return (begin() + idx);
+        }
+
+        void swap( vector& other ) {
+            _words.swap(other._words);
+            ft::swap(_size, other._size);
+        }
+
+        static void swap(reference x, reference y)  {   ft::swap(x, y);    }
+
+        void clear() {
+            _words.clear();
+            _size = 0;
+        }
+
+ // ============================================================================
+
+// Iterators:-------------------------------------------------------------------
+        iterator                begin()         { return iterator(words(), 0);                                                          };
+        iterator                end()           { return iterator(words() + _size / bits_per_word, _size % bits_per_word);          };
+        const_iterator          begin() const   { return const_iterator(words(), 0);                                                    };
+        const_iterator          end() const     { return const_iterator(words() + _size / bits_per_word, _size % bits_per_word);    };
+        const_iterator          cbegin() const  { return begin();                                                                      };
+        const_iterator          cend() const    { return end();                                                                        };
+
+        reverse_iterator		rbegin() 		{   return reverse_iterator(end());		    };
+        const_reverse_iterator	rbegin() const  {	return const_reverse_iterator(end());	};
+        reverse_iterator		rend() 			{	return reverse_iterator(begin());		};
+        const_reverse_iterator	rend() const 	{	return const_reverse_iterator(begin());	};
+//==============================================================================
+
+// ALLOCATOR:-------------------------------------------------------------------
+			A get_allocator() const    { return A(_words.get_allocator()); }
+//==============================================================================
+
+// GROWTH POLICY:---------------------------------------------------------------
+			growth_policy_type &		growth_policy()			{ return _words.growth_policy(); }
+			const growth_policy_type &	growth_policy() const	{ return _words.growth_policy(); }
+//==============================================================================
+
+// COMPARISON:------------------------------------------------------------------
+        // the unused bits are zero on both sides, so whole words can be compared
+        friend bool operator == (const vector& l, const vector& r)
+        {
+            return (l._size == r._size
+                    && std::equal(l.words(), l.words() + wordsFor(l._size), r.words()));
+        }
+
+        // the lowest bit where the words differ decides: bit i is element i
+        friend bool operator < (const vector& l, const vector& r)
+        {
+            size_type n = l._size < r._size ? l._size : r._size;
+            const word_type *a = l.words();
+            const word_type *b = r.words();
+            for (size_type i = 0; i * bits_per_word < n; i++)
+            {
+                word_type diff = a[i] ^ b[i];
+                if ((i + 1) * bits_per_word > n)
+                    diff &= lowMask(n);
+                if (diff)
+                    return ((b[i] & (diff & (~diff + 1))) != 0);
+            }
+            return (l._size < r._size);
+        }
+
+        friend vector operator & (vector l, const vector& r)   {   return (l &= r);   }
+        friend vector operator | (vector l, const vector& r)   {   return (l |= r);   }
+        friend vector operator ^ (vector l, const vector& r)   {   return (l ^= r);   }
+//==============================================================================
+    };
+// END CLASS VECTOR<BOOL> ******************************************************
+
+} // endnamespace ft
+
+#endif
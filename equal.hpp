@@ -24,6 +24,55 @@ namespace ft
 	template <class T, class U>
 	struct conditional<false, T, U> { typedef U type; };
 
+	template <class T>
+	struct is_class
+	{
+		template <class U> static char	test (int U::*);
+		template <class U> static long	test (...);
+		static const bool value = sizeof(test<T>(0)) == sizeof(char);
+	};
+
+	template <class T, bool = is_class<T>::value>
+	struct is_empty { static const bool value = false; };
+
+	template <class T>
+	struct is_empty<T, true>
+	{
+		struct probe : T { char c; };
+		static const bool value = sizeof(probe) == sizeof(char);
+	};
+
+	// true when Compare declares is_transparent, i.e. compares keys against
+	// other types directly; K only defers the check to overload resolution
+	template <class Compare, class K>
+	struct is_transparent
+	{
+		template <class C> static char	test (typename C::is_transparent *);
+		template <class C> static long	test (...);
+		static const bool value = sizeof(test<Compare>(0)) == sizeof(char);
+	};
+
+	// Holds a T; an empty T becomes a base class instead of a member so it
+	// takes no room in whatever derives from the holder.
+	template <class T, bool = is_empty<T>::value>
+	class ebo_store
+	{
+		T		val;
+		public:
+			explicit ebo_store (const T & v) : val(v) {}
+			T &			get ()			{	return val;	}
+			const T &	get () const	{	return val;	}
+	};
+
+	template <class T>
+	class ebo_store<T, true> : private T
+	{
+		public:
+			explicit ebo_store (const T & v) : T(v) {}
+			T &			get ()			{	return *this;	}
+			const T &	get () const	{	return *this;	}
+	};
+
 
 
 
@@ -73,6 +122,44 @@ namespace ft
 	template <> struct
 		is_integral<bool>				:	public true_type		{};
 
+	template <class T>
+		struct is_floating_point		:	public integral_constant<bool, is_same<T, float>::value
+											|| is_same<T, double>::value || is_same<T, long double>::value>	{};
+
+	// Types whose objects can be copied as raw bytes and need no destructor
+	// call. Where the compiler can tell, every type is covered (POD structs,
+	// enums...); otherwise only arithmetic types and pointers are known.
+	// Specialise it for your own types when needed.
+# if defined(__GNUC__)
+	template <class T>
+		struct is_trivially_copyable	:	public integral_constant<bool, __is_trivially_copyable(T)>	{};
+# else
+	template <class T>
+		struct is_trivially_copyable	:	public integral_constant<bool, is_integral<T>::value
+											|| is_floating_point<T>::value>	{};
+	template <class T> struct
+		is_trivially_copyable<T*>		:	public true_type		{};
+# endif
+
+	// Types whose default initialisation does nothing, so fresh storage may
+	// be used as is (its bytes are indeterminate until written).
+# if defined(__GNUC__)
+	template <class T>
+		struct is_trivially_default_constructible	:	public integral_constant<bool, __is_trivially_constructible(T)>	{};
+# else
+	template <class T>
+		struct is_trivially_default_constructible	:	public integral_constant<bool, is_integral<T>::value
+											|| is_floating_point<T>::value>	{};
+	template <class T> struct
+		is_trivially_default_constructible<T*>	:	public true_type		{};
+# endif
+
+	// Types that may be moved to another address with memcpy, the old bytes
+	// being dropped without a destructor call. True for trivially copyable
+	// types; specialise it for e.g. types owning a heap pointer.
+	template <class T>
+		struct is_trivially_relocatable	:	public is_trivially_copyable<T>	{};
+
 
 	template<typename T>
 	void	swap(T &first, T &second)
@@ -0,0 +1,441 @@
+#ifndef INCREMENTAL_VECTOR_HPP
+# define INCREMENTAL_VECTOR_HPP
+
+# include "vector.hpp"
+# include "IteratorSegmented.hpp"
+
+# include <functional>
+
+    namespace   ft {
+
+    // A vector whose growth is spread over time. When it is full it allocates
+    // a buffer twice the size and carries on there; the old elements are
+    // moved over Step at a time by the following push_backs, and until then
+    // an element is read from whichever buffer holds it. With Step >= 2 the
+    // move is over long before the new buffer fills up, so no push_back does
+    // more than Step relocations plus one allocation, instead of copying the
+    // whole vector once in a while.
+    //
+    // Elements live in two arrays during a migration, so iterators go through
+    // operator[] (IteratorSegmented) and there is no data(). reserve() and
+    // a grow that finds the previous migration unfinished (only possible
+    // after pop_backs, or with Step 1) finish it at once.
+    template<typename T, typename A = std::allocator<T>, std::size_t Step = 2>
+// class INCREMENTAL_VECTOR ****************************************************
+    class incremental_vector {
+
+        public :
+            typedef	T														value_type;
+			typedef A   													allocator_type;
+
+			typedef typename allocator_type::reference						reference;
+			typedef typename allocator_type::const_reference				const_reference;
+			typedef typename allocator_type::pointer						pointer;
+			typedef typename allocator_type::const_pointer					const_pointer;
+
+			typedef ft::IteratorSegmented<false, incremental_vector>		iterator;
+			typedef ft::IteratorSegmented<true, incremental_vector>		const_iterator;
+			typedef ft::reverse_iterator<iterator>							reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+			typedef std::ptrdiff_t											difference_type;
+			typedef size_t													size_type;
+
+        private:
+
+            allocator_type	 _alloc;
+            size_type _capacity;
+            value_type *arr;
+            size_type _size;
+            // the previous buffer: elements [_moved, _old_size) are still there
+            value_type *_old;
+            size_type _old_capacity;
+            size_type _old_size;
+            size_type _moved;
+
+            typedef ft::integral_constant<bool, ft::is_trivially_relocatable<T>::value
+                        && ft::allocator_ext<A>::plain_construct>			trivial_relocate;
+
+# if __cplusplus >= 201103L
+            template <class... Args>
+            void constructAt(value_type *p, Args&&... args)
+            {   std::allocator_traits<A>::construct(_alloc, p, std::forward<Args>(args)...);   }
+
+            void destroyAt(value_type *p)   {   std::allocator_traits<A>::destroy(_alloc, p);   }
+# else
+            void constructAt(value_type *p, const value_type& val)  {   _alloc.construct(p, val);   }
+
+            void destroyAt(value_type *p)   {   _alloc.destroy(p);  }
+# endif
+
+            bool migrating() const  {   return (_old != NULL);  }
+
+            // p is an element the next migration step may move
+            bool inOldBuffer(const value_type *p) const
+            {
+                std::less<const value_type *> lt;
+                return (migrating() && !lt(p, _old + _moved) && lt(p, _old + _old_size));
+            }
+
+            // where element i lives right now
+            value_type *slot(size_type i) const
+            {
+                if (i - _moved < _old_size - _moved)
+                    return (_old + i);
+                return (arr + i);
+            }
+
+            // moves up to n elements from the old buffer to the new one, and
+            // lets the old buffer go once it is empty
+            void migrate(size_type n)
+            {
+                size_type end = _old_size - _moved < n ? _old_size : _moved + n;
+                if (trivial_relocate::value)
+                {
+                    if (end > _moved)
+                        std::memcpy(static_cast<void *>(arr + _moved), static_cast<const void *>(_old + _moved),
+                                    (end - _moved) * sizeof(value_type));
+                    _moved = end;
+                }
+                for (; _moved < end; _moved++)
+                {
+# if __cplusplus >= 201103L
+                    constructAt(arr + _moved, std::move_if_noexcept(_old[_moved]));
+# else
+                    constructAt(arr + _moved, _old[_moved]);
+# endif
+                    destroyAt(_old + _moved);
+                }
+                if (_moved == _old_size)
+                {
+                    _alloc.deallocate(_old, _old_capacity);
+                    _old = NULL;
+                    _old_capacity = 0;
+                    _old_size = 0;
+                    _moved = 0;
+                }
+            }
+
+            void finishMigration()
+            {
+                if (migrating())
+                    migrate(_old_size - _moved);
+            }
+
+            // a full buffer: start over in one twice the size and leave the
+            // elements where they are for now
+            void grow()
+            {
+                finishMigration();
+                size_type new_cap = _capacity ? _capacity * 2 : 1;
+                if (new_cap > max_size())
+                    throw std::length_error("incremental_vector:_Maximum_size_out");
+                value_type *tmp = _alloc.allocate(new_cap);
+                if (_size == 0)
+                {
+                    if (_capacity)
+                        _alloc.deallocate(arr, _capacity);
+                }
+                else
+                {
+                    _old = arr;
+                    _old_capacity = _capacity;
+                    _old_size = _size;
+                    _moved = 0;
+                }
+                arr = tmp;
+                _capacity = new_cap;
+            }
+
+            // the slot for the next push_back, after this call's share of the
+            // migration
+            value_type *endSlot()
+            {
+                if (migrating())
+                    migrate(Step);
+                if (_size == _capacity)
+                    grow();
+                return (arr + _size);
+            }
+
+            void release()
+            {
+                clear();
+                if (_capacity)
+                    _alloc.deallocate(arr, _capacity);
+                arr = NULL;
+                _capacity = 0;
+            }
+
+        public:
+// CONSTRUCTORS-------------------------------------------------------------------
+
+            explicit	incremental_vector( const allocator_type& alloc = allocator_type() )	:
+                        _alloc(alloc), _capacity(0), arr(NULL), _size(0),
+                        _old(NULL), _old_capacity(0), _old_size(0), _moved(0) {};
+
+			explicit	incremental_vector( size_type n, const value_type& val = value_type(),
+							const allocator_type& alloc = allocator_type() )    :
+                        _alloc(alloc), _capacity(0), arr(NULL), _size(0),
+                        _old(NULL), _old_capacity(0), _old_size(0), _moved(0)
+            {
+                try { resize(n, val); }
+                catch (...) { release(); throw; }
+            };
+
+			template <class InputIterator>
+			incremental_vector( InputIterator first, InputIterator last,
+                const allocator_type& alloc = allocator_type(),
+                typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)	:
+                _alloc(alloc), _capacity(0), arr(NULL), _size(0),
+                _old(NULL), _old_capacity(0), _old_size(0), _moved(0)
+            {
+                try {
+                    for (; first != last; ++first)
+                        push_back(*first);
+                } catch (...) { release(); throw; }
+            };
+
+			incremental_vector( const incremental_vector& x )	:
+                        _alloc(x._alloc), _capacity(0), arr(NULL), _size(0),
+                        _old(NULL), _old_capacity(0), _old_size(0), _moved(0)
+            {
+                try { *this = x; }
+                catch (...) { release(); throw; }
+            };
+
+# if __cplusplus >= 201103L
+            incremental_vector( incremental_vector&& x ) noexcept	:
+                        _alloc(x._alloc), _capacity(0), arr(NULL), _size(0),
+                        _old(NULL), _old_capacity(0), _old_size(0), _moved(0)
+            {   swap(x);    }
+
+            incremental_vector&		operator = (incremental_vector&& x)
+            {
+                if (this != &x)
+                {
+                    release();
+                    swap(x);
+                }
+                return *this;
+            }
+# endif
+
+			incremental_vector&		operator = (const incremental_vector& x)
+			{
+                if (this == &x)
+                    return *this;
+                size_type n = _size < x._size ? _size : x._size;
+                for (size_type i = 0; i < n; i++)
+                    (*this)[i] = x[i];
+                while (_size > n)
+                    pop_back();
+                reserve(x._size);
+                for (size_type i = n; i < x._size; i++)
+                    push_back(x[i]);
+				return *this;
+			}
+// DESTRUCTOR-------------------------------------------------------------------
+            ~incremental_vector()   {   release();  }
+
+// Element access:--------------------------------------------------------------
+        T &operator[](size_type index)              {   return (*slot(index));  }
+
+        const T &operator[] (size_type index) const {   return (*slot(index));  }
+
+        T &at (size_type n)
+        {
+            if (n >= _size)
+                throw std::out_of_range("_M_range_check");
+            return (*slot(n));
+        }
+
+        const T &at (size_type n) const
+        {
+            if (n >= _size)
+                throw std::out_of_range("_M_range_check");
+            return (*slot(n));
+        }
+
+        T& front()                  {   return (*slot(0));  }
+        const T& front() const      {   return (*slot(0));  }
+        T& back()                   {   return (*slot(_size - 1));  }
+        const T& back() const       {   return (*slot(_size - 1));  }
+
+//==============================================================================
+
+// Capacity:--------------------------------------------------------------------
+
+        size_type size() const { return (_size); }
+
+# if __cplusplus >= 201103L
+        size_type max_size() const { return std::allocator_traits<A>::max_size(_alloc); }
+# else
+        size_type max_size() const { return _alloc.max_size(); }
+# endif
+
+        void resize (size_type n, const value_type& val = value_type())
+        {
+            while (_size > n)
+                pop_back();
+            while (_size < n)
+                push_back(val);
+        }
+
+        size_type capacity() const { return (_capacity); }
+
+        bool empty() const  { return (_size == 0); }
+
+        // the one operation that still moves everything at once
+        void reserve( size_type new_cap ) {
+            finishMigration();
+            if (new_cap <= _capacity)
+                return;
+            if (new_cap > max_size())
+                throw std::length_error("incremental_vector:_Maximum_size_out");
+            value_type *tmp = _alloc.allocate(new_cap);
+            if (_size > 0)
+            {
+                _old = arr;
+                _old_capacity = _capacity;
+                _old_size = _size;
+                _moved = 0;
+                arr = tmp;
+                _capacity = new_cap;
+                finishMigration();
+                return;
+            }
+            if (_capacity)
+                _alloc.deallocate(arr, _capacity);
+            arr = tmp;
+            _capacity = new_cap;
+        }
+
+        // true while some elements still sit in the previous buffer
+        bool is_migrating() const   {   return (migrating());   }
+
+//==============================================================================
+
+// Modifiers:-------------------------------------------------------------------
+        // elem is copied first if the migration step could move it
+        void push_back(const value_type& elem) {
+            if (inOldBuffer(&elem))
+            {
+                value_type copy(elem);
+                constructAt(endSlot(), copy);
+            }
+            else
+                constructAt(endSlot(), elem);
+            _size++;
+        }
+
+        void pop_back(void) {
+            if (_size == 0)
+                return;
+            destroyAt(slot(_size - 1));
+            _size--;
+            if (migrating() && _old_size > _size)
+            {
+                _old_size = _size;
+                migrate(0);
+            }
+        }
+
+# if __cplusplus >= 201103L
+        void push_back(value_type&& elem)   {   emplace_back(std::move(elem));  }
+
+        template <class... Args>
+        reference emplace_back(Args&&... args) {
+            value_type *p;
+            if (migrating())
+            {
+                value_type tmp(std::forward<Args>(args)...);    // args may refer to an element
+                p = endSlot();
+                constructAt(p, std::move(tmp));
+            }
+            else
+            {
+                p = endSlot();
+                constructAt(p, std::forward<Args>(args)...);
+            }
+            _size++;
+            return (*p);
+        }
+# endif
+
+        void swap( incremental_vector& other ) {
+                ft::swap(_alloc, other._alloc);
+				ft::swap(_capacity, other._capacity);
+				ft::swap(arr, other.arr);
+				ft::swap(_size, other._size);
+				ft::swap(_old, other._old);
+				ft::swap(_old_capacity, other._old_capacity);
+				ft::swap(_old_size, other._old_size);
+				ft::swap(_moved, other._moved);
+        }
+
+        void clear() {
+            while (_size > 0)
+                pop_back();
+        }
+
+ // ============================================================================
+
+// Iterators:-------------------------------------------------------------------
+        iterator                begin()         { return iterator(this, 0);             };
+        iterator                end()           { return iterator(this, _size);         };
+        const_iterator          begin() const   { return const_iterator(this, 0);       };
+        const_iterator          end() const     { return const_iterator(this, _size);   };
+
+        reverse_iterator		rbegin() 		{   return reverse_iterator(end());		    };
+        const_reverse_iterator	rbegin() const  {	return const_reverse_iterator(end());	};
+        reverse_iterator		rend() 			{	return reverse_iterator(begin());		};
+        const_reverse_iterator	rend() const 	{	return const_reverse_iterator(begin());	};
+//==============================================================================
+
+// ALLOCATOR:-------------------------------------------------------------------
+			A get_allocator() const    { return _alloc; }
+//==============================================================================
+    };
+// END CLASS INCREMENTAL_VECTOR ************************************************
+
+
+template <class T, class Alloc, std::size_t S>
+	bool	operator == (const incremental_vector<T,Alloc,S>& l, const incremental_vector<T,Alloc,S>& r)
+	{
+		if (l.size() != r.size())	return false;
+		return ft::equal(l.begin(), l.end(), r.begin());
+	};
+
+	template <class T, class Alloc, std::size_t S>
+	bool	operator != ( const incremental_vector<T,Alloc,S>& l,
+						 const incremental_vector<T,Alloc,S>& r )
+    {	return !(l == r);		};
+
+	template <class T, class Alloc, std::size_t S>
+	bool	operator < ( const incremental_vector<T,Alloc,S>& l,
+						 const incremental_vector<T,Alloc,S>& r )
+    {	return ft::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());		};
+
+	template <class T, class Alloc, std::size_t S>
+	bool	operator <= ( const incremental_vector<T,Alloc,S>& l,
+						 const incremental_vector<T,Alloc,S>& r )
+    {	return !(r < l);		};
+
+	template <class T, class Alloc, std::size_t S>
+	bool	operator > ( const incremental_vector<T,Alloc,S>& l,
+						 const incremental_vector<T,Alloc,S>& r )
+    {	return r < l;			};
+
+	template <class T, class Alloc, std::size_t S>
+	bool	operator >= ( const incremental_vector<T,Alloc,S>& l,
+						 const incremental_vector<T,Alloc,S>& r )
+    {	return !(l < r);		};
+
+	template <class T, class Alloc, std::size_t S>
+	void	swap(incremental_vector<T,Alloc,S>& x, incremental_vector<T,Alloc,S>& y)
+    {	x.swap(y);				};
+
+
+} // endnamespace ft
+
+#endif
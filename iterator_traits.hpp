@@ -99,7 +99,7 @@ namespace   ft {
 
 	template<typename InputIterator>
 	typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last,
-		typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
+		std::input_iterator_tag)
 	{
 		typename ft::iterator_traits<InputIterator>::difference_type n = 0;
 
@@ -107,6 +107,16 @@ namespace   ft {
 		return n;
 	}
 
+	template<typename RandomIterator>
+	typename ft::iterator_traits<RandomIterator>::difference_type distance(RandomIterator first, RandomIterator last,
+		std::random_access_iterator_tag)
+	{	return (last - first);	}
+
+	template<typename InputIterator>
+	typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last,
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
+	{	return (ft::distance(first, last, typename ft::iterator_traits<InputIterator>::iterator_category()));	}
+
      template <class Category, class T, class Distance = ptrdiff_t,  class Pointer = T*, class Reference = T&>
         class iteratorT
         {
@@ -0,0 +1,113 @@
+#ifndef MREMAP_ALLOCATOR_HPP
+# define MREMAP_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <new>
+# include <limits>
+# include "AllocatorTraits.hpp"
+
+# ifdef __linux__
+#  include <sys/mman.h>
+# endif
+
+namespace ft {
+
+	// An allocator for big buffers of trivially relocatable elements. Blocks
+	// of at least Threshold bytes are mapped straight from the kernel, and on
+	// Linux reallocate() grows them with mremap(): the pages are remapped,
+	// not copied, and the old and new block never exist side by side. Smaller
+	// blocks come from operator new and are grown the usual way. Elsewhere it
+	// is a plain operator new allocator.
+	template < class T, std::size_t Threshold = 1024 * 1024 >
+	class mremap_allocator
+	{
+		public:
+			typedef T				value_type;
+			typedef T *				pointer;
+			typedef const T *		const_pointer;
+			typedef T &				reference;
+			typedef const T &		const_reference;
+			typedef std::size_t		size_type;
+			typedef std::ptrdiff_t	difference_type;
+
+			template < class U >
+			struct rebind	{	typedef mremap_allocator<U, Threshold> other;	};
+
+			mremap_allocator ()	{}
+			template < class U >
+			mremap_allocator (const mremap_allocator<U, Threshold> &)	{}
+
+			pointer			address (reference x) const			{	return (&x);	}
+			const_pointer	address (const_reference x) const	{	return (&x);	}
+
+			size_type		max_size () const	{	return (std::numeric_limits<size_type>::max() / sizeof(T));	}
+
+			void	construct (pointer p, const T & val)	{	new (static_cast<void *>(p)) T(val);	}
+			void	destroy (pointer p)						{	p->~T();	}
+
+			pointer allocate (size_type n, const void * = 0)
+			{
+				if (n > max_size())
+					throw std::bad_alloc();
+# ifdef __linux__
+				if (mapped(n))
+				{
+					void *p = mmap(NULL, n * sizeof(T), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+					if (p == MAP_FAILED)
+						throw std::bad_alloc();
+					return (static_cast<pointer>(p));
+				}
+# endif
+				return (static_cast<pointer>(::operator new(n * sizeof(T))));
+			}
+
+			void deallocate (pointer p, size_type n)
+			{
+# ifdef __linux__
+				if (mapped(n))
+				{
+					munmap(p, n * sizeof(T));
+					return;
+				}
+# endif
+				::operator delete(p);
+			}
+
+			// a mapped block grown or shrunk with mremap; NULL otherwise
+			pointer reallocate (pointer p, size_type old_n, size_type new_n)
+			{
+# ifdef __linux__
+				if (mapped(old_n) && mapped(new_n) && new_n <= max_size())
+				{
+					void *q = mremap(p, old_n * sizeof(T), new_n * sizeof(T), MREMAP_MAYMOVE);
+					if (q != MAP_FAILED)
+						return (static_cast<pointer>(q));
+				}
+# else
+				(void)p; (void)old_n; (void)new_n;
+# endif
+				return (NULL);
+			}
+
+		private:
+			static bool	mapped (size_type n)	{	return (n >= (Threshold + sizeof(T) - 1) / sizeof(T));	}
+	};
+
+	template < class T, class U, std::size_t N >
+	bool operator== (const mremap_allocator<T, N> &, const mremap_allocator<U, N> &)	{	return (true);	}
+
+	template < class T, class U, std::size_t N >
+	bool operator!= (const mremap_allocator<T, N> &, const mremap_allocator<U, N> &)	{	return (false);	}
+
+	template < class T, std::size_t N >
+	struct allocator_ext< mremap_allocator<T, N> >
+	{
+		static const bool plain_construct = true;
+		static const bool can_reallocate = true;
+
+		static T * reallocate (mremap_allocator<T, N> & a, T * p, std::size_t old_n, std::size_t new_n)
+		{	return (a.reallocate(p, old_n, new_n));	}
+	};
+}
+
+#endif
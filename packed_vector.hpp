@@ -0,0 +1,404 @@
+#ifndef PACKED_VECTOR_HPP
+# define PACKED_VECTOR_HPP
+
+# include "vector.hpp"
+# include "IteratorSegmented.hpp"
+
+# include <climits>
+
+    namespace   ft {
+
+    // Decodes nb blocks of 64 B-bit values (B words each) into out. With B
+    // a constant and the loop unrolled, every shift is known and the test
+    // for a value spanning two words is gone: straight-line code the
+    // compiler can schedule and vectorise.
+    template <std::size_t B>
+    struct packed_block
+    {
+        static void unpack(const unsigned long long *w, std::size_t nb, unsigned int *out)
+        {
+            const unsigned long long m = (1ULL << B) - 1;
+            for (; nb > 0; nb--, w += B, out += 64)
+            {
+# if defined(__GNUC__)
+#  pragma GCC unroll 64
+# endif
+                for (std::size_t j = 0; j < 64; j++)
+                {
+                    std::size_t bit = j * B;
+                    unsigned long long v = w[bit / 64] >> (bit % 64);
+                    if (bit % 64 + B > 64)
+                        v |= w[bit / 64 + 1] << (64 - bit % 64);
+                    out[j] = static_cast<unsigned int>(v & m);
+                }
+            }
+        }
+
+        // picks the kernel for a width only known at run time (>= B)
+        static void dispatch(std::size_t bits, const unsigned long long *w, std::size_t nb, unsigned int *out)
+        {
+            if (bits == B)
+                unpack(w, nb, out);
+            else
+                packed_block<B + 1>::dispatch(bits, w, nb, out);
+        }
+    };
+
+    template <>
+    struct packed_block<33>
+    {
+        static void dispatch(std::size_t, const unsigned long long *, std::size_t, unsigned int *) {}
+    };
+
+    // Unsigned ints kept at a fixed bit width, back to back in 64-bit words:
+    // element i takes bits [i * w, (i + 1) * w), which may span two words.
+    // The width starts at Bits; storing a value that does not fit widens the
+    // vector to that value's width, repacking every element (at most once
+    // per extra bit, 32 bits being the limit). get() / set() and operator[]
+    // are O(1), operator[] and the iterators (IteratorSegmented) going
+    // through a proxy. unpack() decodes a run of elements into a plain
+    // buffer, the fast way to scan.
+    template<std::size_t Bits, typename A = std::allocator<unsigned int> >
+// class PACKED_VECTOR *********************************************************
+    class packed_vector {
+
+        public :
+            typedef	unsigned int											value_type;
+			typedef A   													allocator_type;
+			typedef unsigned long long										word_type;
+
+            // what operator[] gives out: reads with get(), writes with set()
+            class reference
+            {
+                packed_vector *	v;
+                std::size_t		i;
+
+                public:
+                    reference (packed_vector *v, std::size_t i)	: v(v), i(i)	{}
+                    reference (const reference & x)	: v(x.v), i(x.i)	{}
+
+                    operator value_type () const	{	return (v->get(i));	}
+
+                    reference & operator= (value_type x)	{	v->set(i, x); return (*this);	}
+                    reference & operator= (const reference & x)	{	return (*this = value_type(x));	}
+            };
+
+			typedef value_type												const_reference;
+			typedef reference *												pointer;
+			typedef const value_type *										const_pointer;
+
+			typedef ft::IteratorSegmented<false, packed_vector>				iterator;
+			typedef ft::IteratorSegmented<true, packed_vector>				const_iterator;
+			typedef ft::reverse_iterator<iterator>							reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+			typedef std::ptrdiff_t											difference_type;
+			typedef size_t													size_type;
+
+            static const size_type initial_bits = Bits;
+            static const size_type max_bits = sizeof(value_type) * CHAR_BIT;
+
+        private:
+            typedef typename A::template rebind<word_type>::other           word_allocator;
+            typedef ft::vector<word_type, word_allocator>                   word_vector;
+
+            static const size_type word_bits = sizeof(word_type) * CHAR_BIT;
+
+            // one word more than the elements need, so reading the word after
+            // an element's first one is always in bounds; the bits past the
+            // last element are zero
+            word_vector _words;
+            size_type _size;
+            size_type _bits;
+
+            typedef char bits_between_1_and_32[Bits >= 1 && Bits <= max_bits ? 1 : -1];
+
+            static size_type wordsFor(size_type n, size_type bits)  {   return ((n * bits + word_bits - 1) / word_bits + 1); }
+
+            static word_type maskFor(size_type bits)    {   return ((word_type(1) << bits) - 1);  }
+
+            static size_type widthOf(value_type x)
+            {
+                size_type n = 0;
+                for (; x; x >>= 1)
+                    n++;
+                return (n);
+            }
+
+            // the low part from the first word, the rest from the next one;
+            // shifting that one in two steps keeps off == 0 defined
+            static value_type load(const word_type *w, size_type bits, size_type i)
+            {
+                size_type bit = i * bits;
+                size_type off = bit % word_bits;
+                w += bit / word_bits;
+                return (value_type(((w[0] >> off) | ((w[1] << 1) << (word_bits - 1 - off))) & maskFor(bits)));
+            }
+
+            static void store(word_type *w, size_type bits, size_type i, value_type x)
+            {
+                size_type bit = i * bits;
+                size_type off = bit % word_bits;
+                word_type m = maskFor(bits);
+                w += bit / word_bits;
+                w[0] = (w[0] & ~(m << off)) | (word_type(x) << off);
+                if (off + bits > word_bits)
+                    w[1] = (w[1] & ~(m >> (word_bits - off))) | (word_type(x) >> (word_bits - off));
+            }
+
+            // repacks everything at bits (> _bits) wide
+            void widen(size_type bits)
+            {
+                word_vector tmp(wordsFor(_size, bits), word_type(0), _words.get_allocator());
+                for (size_type i = 0; i < _size; i++)
+                    store(tmp.data(), bits, i, load(_words.data(), _bits, i));
+                _words.swap(tmp);
+                _bits = bits;
+            }
+
+            void fits(value_type x)
+            {
+                if (x > maskFor(_bits))
+                    widen(widthOf(x));
+            }
+
+            // drops the elements from n on, zeroing their bits
+            void truncate(size_type n)
+            {
+                size_type bit = n * _bits;
+                word_type *w = _words.data() + bit / word_bits;
+                *w &= maskFor(bit % word_bits);
+                std::fill(w + 1, _words.data() + _words.size(), word_type(0));
+                _words.resize(wordsFor(n, _bits));
+                _size = n;
+            }
+
+        public:
+// CONSTRUCTORS-------------------------------------------------------------------
+
+            explicit	packed_vector( const allocator_type& alloc = allocator_type() )	:
+                        _words(1, word_type(0), word_allocator(alloc)), _size(0), _bits(Bits)    {};
+
+			explicit	packed_vector( size_type n, const value_type& val = value_type(),
+							const allocator_type& alloc = allocator_type() )    :
+                        _words(1, word_type(0), word_allocator(alloc)), _size(0), _bits(Bits)
+            {   resize(n, val);   };
+
+			template <class InputIterator>
+			packed_vector( InputIterator first, InputIterator last,
+                const allocator_type& alloc = allocator_type(),
+                typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)	:
+                _words(1, word_type(0), word_allocator(alloc)), _size(0), _bits(Bits)
+            {
+                for (; first != last; ++first)
+                    push_back(*first);
+            };
+
+# if __cplusplus >= 201103L
+            packed_vector( const packed_vector& ) = default;
+            packed_vector& operator = (const packed_vector&) = default;
+
+            // x is left empty, at its initial width
+            packed_vector( packed_vector&& x )	:
+                        _words(1, word_type(0), x._words.get_allocator()), _size(0), _bits(Bits)
+            {   swap(x);    }
+
+            packed_vector&		operator = (packed_vector&& x)
+            {
+                if (this != &x)
+                {
+                    clear();
+                    swap(x);
+                }
+                return *this;
+            }
+# endif
+
+// Element access:--------------------------------------------------------------
+        value_type get (size_type index) const
+        {
+            FT_ASSERT(index < _size, "packed_vector::get out of range");
+            return (load(_words.data(), _bits, index));
+        }
+
+        // widens the vector first when x needs more bits than it has
+        void set (size_type index, value_type x)
+        {
+            FT_ASSERT(index < _size, "packed_vector::set out of range");
+            fits(x);
+            store(_words.data(), _bits, index, x);
+        }
+
+        reference operator[](size_type index)               {   return (reference(this, index));    }
+
+        const_reference operator[] (size_type index) const  {   return (get(index));    }
+
+        reference at (size_type n)
+        {
+            if (n >= _size)
+                throw std::out_of_range("_M_range_check");
+            return (reference(this, n));
+        }
+
+        const_reference at (size_type n) const
+        {
+            if (n >= _size)
+                throw std::out_of_range("_M_range_check");
+            return (get(n));
+        }
+
+        reference front()                   {   return (reference(this, 0));    }
+        const_reference front() const       {   return (get(0));    }
+        reference back()                    {   return (reference(this, _size - 1));    }
+        const_reference back() const        {   return (get(_size - 1));    }
+
+        // Decodes the n elements from first on into out: one by one up to a
+        // multiple of 64, then 64 at a time with the kernel for the current
+        // width (packed_block), the rest one by one again.
+        void unpack (size_type first, size_type n, value_type *out) const
+        {
+            FT_ASSERT(first + n <= _size, "packed_vector::unpack out of range");
+            const word_type *w = _words.data();
+            size_type last = first + n;
+            for (; first < last && first % word_bits; first++)
+                *out++ = load(w, _bits, first);
+            size_type blocks = (last - first) / word_bits;
+            ft::packed_block<Bits>::dispatch(_bits, w + first / word_bits * _bits, blocks, out);
+            first += blocks * word_bits;
+            out += blocks * word_bits;
+            for (; first < last; first++)
+                *out++ = load(w, _bits, first);
+        }
+
+        void unpack (value_type *out) const {   unpack(0, _size, out);  }
+
+        // bits per element right now
+        size_type bits() const  {   return (_bits); }
+
+//==============================================================================
+
+// Capacity:--------------------------------------------------------------------
+
+        size_type size() const { return (_size); }
+
+        size_type max_size() const { return ((_words.max_size() - 1) / max_bits * word_bits); }
+
+        void resize (size_type n, const value_type& val = value_type())
+        {
+            if (n > max_size())
+                throw std::length_error("packed_vector:_Maximum_size_out");
+            if (n <= _size)
+            {
+                truncate(n);
+                return;
+            }
+            value_type copy(val);
+            fits(copy);
+            _words.resize(wordsFor(n, _bits), word_type(0));
+            if (copy == 0)
+                _size = n;
+            for (; _size < n; _size++)
+                store(_words.data(), _bits, _size, copy);
+        }
+
+        // at the current width
+        size_type capacity() const { return ((_words.capacity() - 1) * word_bits / _bits); }
+
+        bool empty() const  { return (_size == 0); }
+
+        // room for new_cap elements at the current width
+        void reserve( size_type new_cap ) {
+            if (new_cap > max_size())
+                throw std::length_error("packed_vector:_Maximum_size_out");
+            _words.reserve(wordsFor(new_cap, _bits));
+        }
+
+        void shrink_to_fit() {  _words.shrink_to_fit(); }
+
+//==============================================================================
+
+// Modifiers:-------------------------------------------------------------------
+        void push_back(value_type x) {
+            fits(x);
+            _words.resize(wordsFor(_size + 1, _bits), word_type(0));
+            store(_words.data(), _bits, _size, x);
+            _size++;
+        }
+
+        void pop_back(void) {
+            if (_size > 0)
+                truncate(_size - 1);
+        }
+
+        void swap( packed_vector& other ) {
+				_words.swap(other._words);
+				ft::swap(_size, other._size);
+				ft::swap(_bits, other._bits);
+        }
+
+        // back to the initial width
+        void clear() {
+            _words.assign(1, word_type(0));
+            _size = 0;
+            _bits = Bits;
+        }
+
+ // ============================================================================
+
+// Iterators:-------------------------------------------------------------------
+        iterator                begin()         { return iterator(this, 0);             };
+        iterator                end()           { return iterator(this, _size);         };
+        const_iterator          begin() const   { return const_iterator(this, 0);       };
+        const_iterator          end() const     { return const_iterator(this, _size);   };
+
+        reverse_iterator		rbegin() 		{   return reverse_iterator(end());		    };
+        const_reverse_iterator	rbegin() const  {	return const_reverse_iterator(end());	};
+        reverse_iterator		rend() 			{	return reverse_iterator(begin());		};
+        const_reverse_iterator	rend() const 	{	return const_reverse_iterator(begin());	};
+//==============================================================================
+
+// ALLOCATOR:-------------------------------------------------------------------
+			A get_allocator() const    { return A(_words.get_allocator()); }
+//==============================================================================
+    };
+// END CLASS PACKED_VECTOR *****************************************************
+
+
+template <std::size_t B, class Alloc>
+	bool	operator == (const packed_vector<B,Alloc>& l, const packed_vector<B,Alloc>& r)
+	{
+		if (l.size() != r.size())	return false;
+		return ft::equal(l.begin(), l.end(), r.begin());
+	};
+
+	template <std::size_t B, class Alloc>
+	bool	operator != ( const packed_vector<B,Alloc>& l,
+						 const packed_vector<B,Alloc>& r )
+    {	return !(l == r);		};
+
+	template <std::size_t B, class Alloc>
+	bool	operator < ( const packed_vector<B,Alloc>& l,
+						 const packed_vector<B,Alloc>& r )
+    {	return ft::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());		};
+
+	template <std::size_t B, class Alloc>
+	bool	operator <= ( const packed_vector<B,Alloc>& l,
+						 const packed_vector<B,Alloc>& r )
+    {	return !(r < l);		};
+
+	template <std::size_t B, class Alloc>
+	bool	operator > ( const packed_vector<B,Alloc>& l,
+						 const packed_vector<B,Alloc>& r )
+    {	return r < l;			};
+
+	template <std::size_t B, class Alloc>
+	bool	operator >= ( const packed_vector<B,Alloc>& l,
+						 const packed_vector<B,Alloc>& r )
+    {	return !(l < r);		};
+
+	template <std::size_t B, class Alloc>
+	void	swap(packed_vector<B,Alloc>& x, packed_vector<B,Alloc>& y)
+    {	x.swap(y);				};
+
+} // endnamespace ft
+
+#endif
@@ -28,6 +28,8 @@ namespace   ft {
     
         pair() : first(), second() {};
 
+        pair(const pair &other) :  first(other.first),  second(other.second)        {}
+
         template <typename U1, typename U2>
 	    pair(const pair<U1, U2> &other) :  first(other.first),  second(other.second)        {}   
 
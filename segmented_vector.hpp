@@ -0,0 +1,332 @@
+#ifndef SEGMENTED_VECTOR_HPP
+# define SEGMENTED_VECTOR_HPP
+
+# include "vector.hpp"
+# include "IteratorSegmented.hpp"
+
+    namespace   ft {
+
+    // Largest power of two not above N (1 for N == 0).
+    template <std::size_t N, std::size_t P = 1, bool Done = (P * 2 > N)>
+    struct floor_pow2           { static const std::size_t value = floor_pow2<N, P * 2>::value; };
+    template <std::size_t N, std::size_t P>
+    struct floor_pow2<N, P, true>   { static const std::size_t value = P; };
+
+    // 64KiB worth of elements per chunk, as a power of two so indexing is a
+    // shift and a mask
+    template <class T>
+    struct segment_size         { static const std::size_t value = floor_pow2<65536 / sizeof(T)>::value; };
+
+    // A vector made of fixed-size chunks behind an index of chunk pointers.
+    // Growing allocates one more chunk and never moves an element, so
+    // pointers and references stay valid until the element is removed and a
+    // push_back costs the same at any size (the index itself is a plain
+    // ft::vector, one pointer per Chunk elements). Iterators are random
+    // access, O(1) to dereference, and hold on to the container rather than
+    // a chunk.
+    template<typename T, typename A = std::allocator<T>, std::size_t Chunk = ft::segment_size<T>::value >
+// class SEGMENTED_VECTOR ******************************************************
+    class segmented_vector {
+
+        public :
+            typedef	T														value_type;
+			typedef A   													allocator_type;
+
+			typedef typename allocator_type::reference						reference;
+			typedef typename allocator_type::const_reference				const_reference;
+			typedef typename allocator_type::pointer						pointer;
+			typedef typename allocator_type::const_pointer					const_pointer;
+
+			typedef ft::IteratorSegmented<false, segmented_vector>			iterator;
+			typedef ft::IteratorSegmented<true, segmented_vector>			const_iterator;
+			typedef ft::reverse_iterator<iterator>							reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+			typedef std::ptrdiff_t											difference_type;
+			typedef size_t													size_type;
+
+            static const size_type chunk_size = Chunk;
+
+        private:
+            typedef typename A::template rebind<T*>::other                  index_allocator;
+            typedef ft::vector<T*, index_allocator>                         index_type;
+
+            allocator_type	 _alloc;
+            index_type _chunks;
+            size_type _size;
+
+            typedef ft::integral_constant<bool, ft::is_trivially_copyable<T>::value
+                        && ft::allocator_ext<A>::plain_construct>			trivial_copy;
+
+# if __cplusplus >= 201103L
+            template <class... Args>
+            void constructAt(value_type *p, Args&&... args)
+            {   std::allocator_traits<A>::construct(_alloc, p, std::forward<Args>(args)...);   }
+
+            void destroyAt(value_type *p)   {   std::allocator_traits<A>::destroy(_alloc, p);   }
+# else
+            void constructAt(value_type *p, const value_type& val)  {   _alloc.construct(p, val);   }
+
+            void destroyAt(value_type *p)   {   _alloc.destroy(p);  }
+# endif
+
+            value_type *slot(size_type i) const   {   return (_chunks.data()[i / Chunk] + i % Chunk);   }
+
+            // the slot for the next push_back, adding a chunk when all are full
+            value_type *endSlot()
+            {
+                if (_size == capacity())
+                {
+                    value_type *chunk = _alloc.allocate(Chunk);
+                    try { _chunks.push_back(chunk); }
+                    catch (...) { _alloc.deallocate(chunk, Chunk); throw; }
+                }
+                return (slot(_size));
+            }
+
+            void destroyFrom(size_type n)
+            {
+                if (!trivial_copy::value)
+                    for (size_type i = n; i < _size; i++)
+                        destroyAt(slot(i));
+                _size = n;
+            }
+
+            // gives back the chunks past the first keep ones
+            void releaseChunks(size_type keep)
+            {
+                for (size_type i = keep; i < _chunks.size(); i++)
+                    _alloc.deallocate(_chunks.data()[i], Chunk);
+                _chunks.resize(keep);
+            }
+
+        public:
+// CONSTRUCTORS-------------------------------------------------------------------
+
+            explicit	segmented_vector( const allocator_type& alloc = allocator_type() )	:
+                        _alloc(alloc), _chunks(index_allocator(alloc)), _size(0) {};
+
+			explicit	segmented_vector( size_type n, const value_type& val = value_type(),
+							const allocator_type& alloc = allocator_type() )    :
+                        _alloc(alloc), _chunks(index_allocator(alloc)), _size(0)
+            {
+                try { resize(n, val); }
+                catch (...) { clear(); releaseChunks(0); throw; }
+            };
+
+			template <class InputIterator>
+			segmented_vector( InputIterator first, InputIterator last,
+                const allocator_type& alloc = allocator_type(),
+                typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)	:
+                _alloc(alloc), _chunks(index_allocator(alloc)), _size(0)
+            {
+                try {
+                    for (; first != last; ++first)
+                        push_back(*first);
+                } catch (...) { clear(); releaseChunks(0); throw; }
+            };
+
+			segmented_vector( const segmented_vector& x )	:
+                        _alloc(x._alloc), _chunks(index_allocator(x._alloc)), _size(0)
+            {
+                try { *this = x; }
+                catch (...) { clear(); releaseChunks(0); throw; }
+            };
+
+# if __cplusplus >= 201103L
+            segmented_vector( segmented_vector&& x )	:
+                        _alloc(x._alloc), _chunks(std::move(x._chunks)), _size(x._size)
+            {   x._size = 0;    }
+
+            segmented_vector&		operator = (segmented_vector&& x)
+            {
+                if (this != &x)
+                {
+                    clear();
+                    releaseChunks(0);
+                    swap(x);
+                }
+                return *this;
+            }
+# endif
+
+			segmented_vector&		operator = (const segmented_vector& x)
+			{
+                if (this == &x)
+                    return *this;
+                size_type n = _size < x._size ? _size : x._size;
+                for (size_type i = 0; i < n; i++)
+                    (*this)[i] = x[i];
+                destroyFrom(n);
+                for (size_type i = n; i < x._size; i++)
+                    push_back(x[i]);
+				return *this;
+			}
+// DESTRUCTOR-------------------------------------------------------------------
+            ~segmented_vector()
+            {
+                clear();
+                releaseChunks(0);
+            }
+
+// Element access:--------------------------------------------------------------
+        T &operator[](size_type index)              {   return (*slot(index));  }
+
+        const T &operator[] (size_type index) const {   return (*slot(index));  }
+
+        T &at (size_type n)
+        {
+            if (n >= _size)
+                throw std::out_of_range("_M_range_check");
+            return (*slot(n));
+        }
+
+        const T &at (size_type n) const
+        {
+            if (n >= _size)
+                throw std::out_of_range("_M_range_check");
+            return (*slot(n));
+        }
+
+        T& front()                  {   return (*slot(0));  }
+        const T& front() const      {   return (*slot(0));  }
+        T& back()                   {   return (*slot(_size - 1));  }
+        const T& back() const       {   return (*slot(_size - 1));  }
+
+//==============================================================================
+
+// Capacity:--------------------------------------------------------------------
+
+        size_type size() const { return (_size); }
+
+# if __cplusplus >= 201103L
+        size_type max_size() const { return std::allocator_traits<A>::max_size(_alloc); }
+# else
+        size_type max_size() const { return _alloc.max_size(); }
+# endif
+
+        void resize (size_type n, const value_type& val = value_type())
+        {
+            if (n < _size)
+                destroyFrom(n);
+            while (_size < n)
+                push_back(val);
+        }
+
+        size_type capacity() const { return (_chunks.size() * Chunk); }
+
+        bool empty() const  { return (_size == 0); }
+
+        // allocates the chunks for new_cap elements up front
+        void reserve( size_type new_cap ) {
+            if (new_cap > max_size())
+                throw std::length_error("segmented_vector:_Maximum_size_out");
+            size_type chunks = (new_cap + Chunk - 1) / Chunk;
+            if (chunks <= _chunks.size())
+                return;
+            _chunks.reserve(chunks);
+            while (_chunks.size() < chunks)
+                _chunks.push_back(_alloc.allocate(Chunk));
+        }
+
+        // frees the chunks no element lives in
+        void shrink_to_fit() {
+            releaseChunks((_size + Chunk - 1) / Chunk);
+            _chunks.shrink_to_fit();
+        }
+
+//==============================================================================
+
+// Modifiers:-------------------------------------------------------------------
+        // elements never move, so elem may be one of them
+        void push_back(const value_type& elem) {
+            constructAt(endSlot(), elem);
+            _size++;
+        }
+
+        void pop_back(void) {
+            if (_size > 0)
+                destroyFrom(_size - 1);
+        }
+
+# if __cplusplus >= 201103L
+        void push_back(value_type&& elem)   {   emplace_back(std::move(elem));  }
+
+        template <class... Args>
+        reference emplace_back(Args&&... args) {
+            value_type *p = endSlot();
+            constructAt(p, std::forward<Args>(args)...);
+            _size++;
+            return (*p);
+        }
+# endif
+
+        void swap( segmented_vector& other ) {
+                ft::swap(_alloc, other._alloc);
+				_chunks.swap(other._chunks);
+				ft::swap(_size, other._size);
+        }
+
+        // keeps the chunks for reuse; shrink_to_fit() gives them back
+        void clear() {  destroyFrom(0); }
+
+ // ============================================================================
+
+// Iterators:-------------------------------------------------------------------
+        iterator                begin()         { return iterator(this, 0);             };
+        iterator                end()           { return iterator(this, _size);         };
+        const_iterator          begin() const   { return const_iterator(this, 0);       };
+        const_iterator          end() const     { return const_iterator(this, _size);   };
+
+        reverse_iterator		rbegin() 		{   return reverse_iterator(end());		    };
+        const_reverse_iterator	rbegin() const  {	return const_reverse_iterator(end());	};
+        reverse_iterator		rend() 			{	return reverse_iterator(begin());		};
+        const_reverse_iterator	rend() const 	{	return const_reverse_iterator(begin());	};
+//==============================================================================
+
+// ALLOCATOR:-------------------------------------------------------------------
+			A get_allocator() const    { return _alloc; }
+//==============================================================================
+    };
+// END CLASS SEGMENTED_VECTOR **************************************************
+
+
+template <class T, class Alloc, std::size_t C>
+	bool	operator == (const segmented_vector<T,Alloc,C>& l, const segmented_vector<T,Alloc,C>& r)
+	{
+		if (l.size() != r.size())	return false;
+		return ft::equal(l.begin(), l.end(), r.begin());
+	};
+
+	template <class T, class Alloc, std::size_t C>
+	bool	operator != ( const segmented_vector<T,Alloc,C>& l,
+						 const segmented_vector<T,Alloc,C>& r )
+    {	return !(l == r);		};
+
+	template <class T, class Alloc, std::size_t C>
+	bool	operator < ( const segmented_vector<T,Alloc,C>& l,
+						 const segmented_vector<T,Alloc,C>& r )
+    {	return ft::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());		};
+
+	template <class T, class Alloc, std::size_t C>
+	bool	operator <= ( const segmented_vector<T,Alloc,C>& l,
+						 const segmented_vector<T,Alloc,C>& r )
+    {	return !(r < l);		};
+
+	template <class T, class Alloc, std::size_t C>
+	bool	operator > ( const segmented_vector<T,Alloc,C>& l,
+						 const segmented_vector<T,Alloc,C>& r )
+    {	return r < l;			};
+
+	template <class T, class Alloc, std::size_t C>
+	bool	operator >= ( const segmented_vector<T,Alloc,C>& l,
+						 const segmented_vector<T,Alloc,C>& r )
+    {	return !(l < r);		};
+
+	template <class T, class Alloc, std::size_t C>
+	void	swap(segmented_vector<T,Alloc,C>& x, segmented_vector<T,Alloc,C>& y)
+    {	x.swap(y);				};
+
+
+} // endnamespace ft
+
+#endif
@@ -10,12 +10,13 @@
 # include "equal.hpp"
 # include "pair.hpp"
 # include "Node.hpp"
+# include "NodePool.hpp"
 
 namespace   ft {
 
     template < class T, class Compare = ft::less<T>,
 				class A = std::allocator<T> > 
-    class set {
+    class set : private ft::debug_owner {
 
         public:
             // typedef T                                                     key_type;
@@ -51,133 +52,326 @@ namespace   ft {
 
         private:
             
-            allocator_type		alloc;
-			key_compare			comp;
-			node *				root;
-			node *				nil_node;
-			size_type			_size;
-			
+			// the comparator and the allocator (inside the pool) are base
+			// classes, so stateless ones take no room
+			struct tree_impl : ft::ebo_store<key_compare>, node_pool<node, allocator_type>
+			{
+				tree_impl (const key_compare & c, const allocator_type & a)	:
+					ft::ebo_store<key_compare>(c), node_pool<node, allocator_type>(a) {}
+			};
+
+			tree_impl			impl;
+			node_links<node>	_header;
 	
-			node *new_node()
+			// header: parent is the root, left/right cache the leftmost and
+			// rightmost nodes, and it is the end() node that iterators stop on.
+			// It lives inside the container, so an empty tree owns no memory.
+			node * header () const
+			{	return (static_cast<node *>(const_cast<node_links<node> *>(&_header)));	}
+
+			void initHeader()
 			{
-				node * new_n = alloc.allocate(1);
-				new_n->left = NULL;
-				new_n->right = NULL;
-				new_n->parent = NULL;
-				new_n->nil = true;
-				new_n->color = BLACK;
-				return new_n;
+				_header.setColor(RED);
+				resetHeader();
 			}
 
+# ifdef FT_DEBUG
+			// what the checked iterators (Debug.hpp) ask about a node
+			bool debugDereferenceable (const void *pos) const	{	return (pos != header());	}
+			bool debugDecrementable (const void *pos) const		{	return (pos != header()->left);	}
+# endif
+
+			// templated so a transparent comparator sees the caller's key type
+			template <class L, class R>
+			bool comp (const L & a, const R & b) const	{	return (impl.get()(a, b));	}
+
 			node *new_node(const value_type& val)
 			{
-
-				node new_n(val);
-				node *an= new_node();
-				alloc.construct(an, new_n);
-				an->left = nil_node;
-				an->right = nil_node;
-				an->color = RED;
-				an->nil = false;
-				_size++;
+				node *an = impl.allocate();
+				try { impl.get_allocator().construct(an, node(val)); }
+				catch (...) { impl.deallocate(an); throw; }
+				an->setColor(RED);
 				return an;
 			}
 
-			node * leftXod  () const
+			node * root () const	{	return header()->parent();	}
+
+			static node * minimum (node *x)	{	while (x->left) x = x->left; return x;	}
+
+			static node * maximum (node *x)	{	while (x->right) x = x->right; return x;	}
+
+			// first node in [x..] whose key is not less than k, or y if none
+			template <class K>
+			node * lowerBoundNode (node *x, node *y, const K & k) const
 			{
-				node *				tmp;
-				
-				tmp = root;
-				while (tmp->left && !tmp->nil && !tmp->left->nil)
-					tmp = tmp->left;
-				return tmp;
+				while (x)
+				{
+					if (!comp(x->data, k))
+					{	y = x; x = x->left;	}
+					else
+						x = x->right;
+				}
+				return y;
 			}
 
-			node * rightXod  () const
+			// first node in [x..] whose key is greater than k, or y if none
+			template <class K>
+			node * upperBoundNode (node *x, node *y, const K & k) const
 			{
-				node *				tmp;
-				
-				tmp = root;
-				while (tmp != nil_node && tmp->right != nil_node)
-					tmp = tmp->right;
-				nil_node->parent = tmp;
-				return tmp;
+				while (x)
+				{
+					if (comp(k, x->data))
+					{	y = x; x = x->left;	}
+					else
+						x = x->right;
+				}
+				return y;
+			}
+
+			// node holding k, or the header
+			template <class K>
+			node * findNode (const K & k) const
+			{
+				node *y = lowerBoundNode(root(), header(), k);
+				return ((y == header() || comp(k, y->data)) ? header() : y);
+			}
+
+			// one descent until k is hit, then split into the two subtrees
+			template <class K>
+			ft::pair<node *, node *> equalRangeNodes (const K & k) const
+			{
+				node *x = root();
+				node *y = header();
+				while (x)
+				{
+					if (comp(x->data, k))
+						x = x->right;
+					else if (comp(k, x->data))
+					{	y = x; x = x->left;	}
+					else
+						return (ft::make_pair(lowerBoundNode(x->left, x, k), upperBoundNode(x->right, y, k)));
+				}
+				return (ft::make_pair(y, y));
 			}
 
 			void destroyNode(node *x)
 			{
-				alloc.destroy(x);
-				alloc.deallocate(x, 1);
-				_size--;
+				debugInvalidate(x);
+				impl.get_allocator().destroy(x);
+				impl.deallocate(x);
+			}
+
+			// frees a subtree without rebalancing; recursion depth is the tree height
+			void deletedTree(node *x)
+			{
+				while (x)
+				{
+					deletedTree(x->right);
+					node *l = x->left;
+					destroyNode(x);
+					x = l;
+				}
+			}
+
+			void resetHeader()
+			{
+				header()->setParent(NULL);
+				header()->left = header();
+				header()->right = header();
+			}
+
+			// after the links were copied from another header(), point the
+			// root back at this one (an empty tree's header points at itself)
+			void adoptHeader()
+			{
+				if (root())
+					root()->setParent(header());
+				else
+					resetHeader();
 			}
 
-			void deletedTree()
+			// Copies x's shape and colours node by node. Nodes are taken from spare
+			// (linked through right) and get their value assigned in place; new
+			// ones are allocated only once spare runs dry.
+			void cloneFrom(const set & x, node *&spare)
 			{
-				if (!root)
+				if (!x.root())
 					return;
-				iterator it = begin();
-				iterator end_it = end();
-				node *f;
-				
-				while (it != end_it)
+				header()->setParent(cloneTree(x.root(), header(), spare));
+				header()->left = minimum(header()->parent());
+				header()->right = maximum(header()->parent());
+			}
+
+			node *cloneNode(const node *src, node *&spare)
+			{
+				node *x;
+				if (spare)
 				{
-					
-					f = it.getPtr();
-					if (f->nil)
-						break;
-					it++;
-					if (f->parent)
+					x = spare;
+					spare = spare->right;
+					try {
+					x->data = src->data;
+					} catch (...) { impl.get_allocator().destroy(x); impl.deallocate(x); throw; }
+				}
+				else
+					x = new_node(src->data);
+				x->setColor(src->color());
+				x->left = NULL;
+				x->right = NULL;
+				return x;
+			}
+
+			// recurses on right children only, so depth stays at the tree height
+			node *cloneTree(const node *src, node *parent, node *&spare)
+			{
+				node *top = cloneNode(src, spare);
+				top->setParent(parent);
+				try {
+					if (src->right)
+						top->right = cloneTree(src->right, top, spare);
+					parent = top;
+					for (src = src->left; src; src = src->left)
 					{
-						if (f->parent->left == f)
-							f->parent->left = nil_node;
-						else if (f->parent->right == f)
-							f->parent->right = nil_node;
+						node *y = cloneNode(src, spare);
+						parent->left = y;
+						y->setParent(parent);
+						if (src->right)
+							y->right = cloneTree(src->right, y, spare);
+						parent = y;
 					}
-					f->left->parent = f->parent;
-					f->right->parent = f->parent;
-					destroyNode(f);
+				} catch (...) { deletedTree(top); throw; }
+				return top;
+			}
+
+			// unlinks every node of a subtree onto list (through right), values kept
+			void collectNodes(node *x, node *&list)
+			{
+				while (x)
+				{
+					collectNodes(x->right, list);
+					node *l = x->left;
+					x->right = list;
+					list = x;
+					x = l;
 				}
-				
-				alloc.deallocate(nil_node, 1);
+			}
+
+			void freeNodes(node *list)
+			{
+				while (list)
+				{
+					node *next = list->right;
+					impl.get_allocator().destroy(list);
+					impl.deallocate(list);
+					list = next;
+				}
+			}
+
+			// Takes the strictly ascending prefix of [first, last) into an empty tree in
+			// O(n) and returns where that run stopped, so the caller inserts the rest.
+			template <class InputIterator>
+			InputIterator buildSorted (InputIterator first, InputIterator last)
+			{
+				node *head = NULL;
+				node *tail = NULL;
+				size_type n = 0;
+				try {
+					for (; first != last; ++first)
+					{
+						if (tail && !comp(tail->data, (*first)))
+							break;
+						node *x = new_node(*first);
+						if (tail)
+							tail->right = x;
+						else
+							head = x;
+						tail = x;
+						n++;
+					}
+				} catch (...) {
+					while (head) { node *next = head->right; destroyNode(head); head = next; }
+					throw;
+				}
+				if (n > 0)
+					adoptChain(head, tail, n);
+				return first;
+			}
+
+			// makes a balanced tree of n (> 0) ascending nodes linked through right
+			void adoptChain (node *head, node *tail, size_type n)
+			{
+				size_type redDepth = 0;
+				while ((n >> redDepth) > 1)
+					redDepth++;
+				header()->setParent(buildBalanced(head, n, 0, redDepth, header()));
+				header()->parent()->setColor(BLACK);
+				header()->left = minimum(header()->parent());
+				header()->right = tail;
+			}
+
+			// Turns the next n nodes of a right-linked chain into a perfectly balanced
+			// subtree. Only the deepest level is red, so every path has the same
+			// number of black nodes.
+			node *buildBalanced (node *&list, size_type n, size_type depth, size_type redDepth, node *parent)
+			{
+				if (n == 0)
+					return NULL;
+				node *left = buildBalanced(list, n / 2, depth + 1, redDepth, NULL);
+				node *x = list;
+				list = list->right;
+				x->setParent(parent);
+				x->left = left;
+				if (left)
+					left->setParent(x);
+				x->right = buildBalanced(list, n - n / 2 - 1, depth + 1, redDepth, x);
+				x->setColor(depth == redDepth ? RED : BLACK);
+				return x;
 			}
 
 		public:
 // CONSTRUCTORS-------------------------------------------------------------------
-            explicit set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : alloc(alloc), comp(comp)	
+            explicit set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : impl(comp, alloc)	
             {
-				_size = 0;
-				nil_node = new_node();
-				root = nil_node;
+				initHeader();
 			}
 
             template <class InputIterator>  
             set (InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type(),
-					typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0): alloc(alloc), comp(comp) 
-			{	_size = 0; nil_node = new_node(); root = nil_node; insert(first, last);	};
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0): impl(comp, alloc) 
+			{	initHeader(); insert(first, last);	};
            
-            set (const set& x) :  alloc(x.alloc), comp(x.comp){
-				_size = 0;
-				nil_node =new_node();
-				root = nil_node;
-				insert(x.begin(), x.end());
+            set (const set& x) :  ft::debug_owner(), impl(x.impl.get(), x.impl.get_allocator()){
+				initHeader();
+				node *spare = NULL;
+				cloneFrom(x, spare);
 			 };
 
 			set & operator= (const set & x)
 			{
 				if (this == &x)
 					return (*this);
-				deletedTree();
-				comp = x.comp;
-				alloc = x.alloc;
-				_size = 0;
-				nil_node =new_node();
-				root = nil_node;
-				insert(x.begin(), x.end());
+				debugInvalidateExcept(header());
+				impl.get() = x.impl.get();
+				node *spare = NULL;	// counted by size() until freeNodes
+				collectNodes(root(), spare);
+				resetHeader();
+				try { cloneFrom(x, spare); }
+				catch (...) { freeNodes(spare); throw; }
+				freeNodes(spare);
 				return (*this);
 			};
 // DESTRUCTOR-------------------------------------------------------------------
             ~set()
-			{ deletedTree();	};//
+			{
+				// with a stateless comparator and allocator the tree is its header
+				// plus the pool's pointer, no bigger than the plain red-black tree
+# ifndef FT_DEBUG
+				typedef char set_is_four_words[(!ft::is_empty<key_compare>::value
+					|| !ft::is_empty<allocator_type>::value || sizeof(set) == 4 * sizeof(void *)) ? 1 : -1];
+				(void)sizeof(set_is_four_words);
+# endif
+				deletedTree(root());
+			};//
 /*Iterators:----------------------------------------------------------------------
 begin	Return iterator to beginning (public member function)
 end	Return iterator to end (public member function)
@@ -187,13 +381,13 @@ cbegin	Return const_iterator to beginning (public member function)
 cend	Return const_iterator to end (public member function)
 crbegin	Return const_reverse_iterator to reverse beginning (public member function)
 crend	Return const_reverse_iterator to reverse end (public member function)------*/
-		iterator begin()				{	return (iterator(leftXod()));	};
-		const_iterator begin() const	{	return (const_iterator(leftXod()));	};
-		const_iterator cbegin() const	{	return (const_iterator(leftXod()));	};
+		iterator begin()				{	return (iterator(header()->left, this));	};
+		const_iterator begin() const	{	return (const_iterator(header()->left, this));	};
+		const_iterator cbegin() const	{	return (const_iterator(header()->left, this));	};
 				
-		iterator end()					{	return (iterator(nil_node));	};
-		const_iterator end() const 		{	return (const_iterator(nil_node));	};
-		const_iterator cend() const 		{	return (const_iterator(nil_node));	};
+		iterator end()					{	return (iterator(header(), this));	};
+		const_iterator end() const 		{	return (const_iterator(header(), this));	};
+		const_iterator cend() const 		{	return (const_iterator(header(), this));	};
 
 		reverse_iterator rbegin ()		{	return (reverse_iterator(end()));	};
 		const_reverse_iterator rbegin () const	{	return (const_reverse_iterator(end()));};
@@ -204,14 +398,15 @@ crend	Return const_reverse_iterator to reverse end (public member function)-----
 /*Capacity:------------------------------------------------------------------------
 empty	Test whether container is empty (public member function)
 size	Return container size (public member function)
-max_size	Return maximum size (public member function)---------------------------*/
+max_size	Return maximum size (public member function)
+reserve	Pre-allocate room for n elements (extension)-----------------------------*/
 		
 		// node *getRoot() { return root;} // cheking tree
-		// node *getNil() { return nil_node;} // cheking tree  
+		// node *getNil() { return header();} // cheking tree  
 
-		bool empty () const { return root == nil_node; };
+		bool empty () const { return impl.size() == 0; };
 
-		size_type size () const { return this->_size; }
+		size_type size () const { return impl.size(); }
 		// size_type size () const{
 		// 	size_type n = 0;
 		// 	for (const_iterator it = begin() ;  it != end() ; it++)
@@ -219,7 +414,9 @@ max_size	Return maximum size (public member function)---------------------------
 		// 	return (n);
 		// };
 
-		size_type max_size () const	{	return (alloc.max_size());	};
+		size_type max_size () const	{	return (impl.get_allocator().max_size());	};
+
+		void reserve (size_type n)	{	if (n > size()) impl.reserve(n - size());	};
 
 /*Element access:------------------------------------------------------------------
 operator[]	Access element (public member function)
@@ -246,39 +443,93 @@ at	Access element (public member function)--------------------------------------
 /*Modifiers:-----------------------------------------------------------------------
 insert	Insert elements (public member function)							ok
 erase	Erase elements (public member function)								ok
+erase_if	Erase every element matching a predicate (extension)
 swap	Swap content (public member function)
 clear	Clear content (public member function)
 emplace	Construct and insert element (public member function)
 emplace_hint	Construct and insert element with hint (public member function)----*/
 			ft::pair<iterator,bool> insert (const value_type& val)
 			{
-				iterator it = find(val);
-				if (!it.getPtr()->nil)
-					return ft::make_pair(it, false);
-				node *n = insertNode(val);
-				return ft::make_pair(iterator(n), true);
+				node *parent;
+				bool left;
+				node *x = findSlot(val, parent, left);
+				if (x)
+					return ft::make_pair(iterator(x, this), false);
+				return ft::make_pair(iterator(linkNode(parent, left, new_node(val)), this), true);
 			}
 	
+			// attaches val next to position when it fits there, else falls back to insert(val)
 			iterator insert (iterator position, const value_type& val)
-			{ (void)position; return insert(val).first; }
+			{
+				debugOwns(position);
+				node *pos = position.getPtr();
+				if (pos == header())
+					return (insert(val).first);
+				if (comp(val, pos->data))
+				{
+					if (pos == header()->left)
+						return (iterator(linkNode(pos, true, new_node(val)), this));
+					node *before = (--position).getPtr();
+					if (!comp(before->data, val))
+						return (insert(val).first);
+					if (!before->right)
+						return (iterator(linkNode(before, false, new_node(val)), this));
+					return (iterator(linkNode(pos, true, new_node(val)), this));
+				}
+				if (comp(pos->data, val))
+				{
+					if (pos == header()->right)
+						return (iterator(linkNode(pos, false, new_node(val)), this));
+					node *after = (++position).getPtr();
+					if (!comp(val, after->data))
+						return (insert(val).first);
+					if (!pos->right)
+						return (iterator(linkNode(pos, false, new_node(val)), this));
+					return (iterator(linkNode(after, true, new_node(val)), this));
+				}
+				return (iterator(pos, this));
+			}
 				
 			template <class InputIterator>  
 			void insert (InputIterator first, InputIterator last,
 						typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0 )
-			{	while(first != last) insert(*first++);	}
+			{
+				if (empty())
+					first = buildSorted(first, last);
+				while(first != last) insert(*first++);
+			}
 
-			void erase (iterator position)	{	deleteNode(position.getPtr());}
+			void erase (iterator position)
+			{
+				debugOwns(position);
+				position.debugDereferenceable();
+				deleteNode(position.getPtr());
+			}
 
 			size_type erase (const value_type& k)
 			{
-				iterator del = find(k);
-				if (del.getPtr()->nil)
+				node *del = findNode(k);
+				if (del == header())
 					return 0;
-				erase(del);
+				deleteNode(del);
+				return 1;
+			}
+
+			template <class K>
+			size_type erase (const K& k, typename ft::enable_if<ft::is_transparent<Compare, K>::value>::type* = 0)
+			{
+				node *del = findNode(k);
+				if (del == header())
+					return 0;
+				deleteNode(del);
 				return 1;
 			}
 
 			void erase (iterator first, iterator last) {
+				debugOwns(first);
+				debugOwns(last);
+				if (first == begin() && last == end())
+					return (clear());
 				iterator it = first;
 				while(first != last) {
 					++it;
@@ -287,26 +538,70 @@ emplace_hint	Construct and insert element with hint (public member function)----
 				}
 			}
 			
+			// Removes every element pred holds for in one in-order pass, then
+			// rebuilds the survivors into a balanced tree in O(n). If pred throws,
+			// the elements not looked at yet are kept.
+			template <class Predicate>
+			size_type erase_if (Predicate pred)
+			{
+				node *list = NULL;
+				collectNodes(root(), list);
+				resetHeader();
+				node *head = NULL;
+				node *tail = NULL;
+				size_type n = 0;
+				size_type removed = 0;
+				try {
+					for (; list; ) {
+						node *next = list->right;
+						if (pred(list->data))
+						{
+							destroyNode(list);
+							removed++;
+						}
+						else
+						{
+							(tail ? tail->right : head) = list;
+							tail = list;
+							n++;
+						}
+						list = next;
+					}
+				} catch (...) {
+					for (; list; list = list->right, n++)
+					{
+						(tail ? tail->right : head) = list;
+						tail = list;
+					}
+					if (n > 0)
+						adoptChain(head, tail, n);
+					throw;
+				}
+				if (n > 0)
+					adoptChain(head, tail, n);
+				return (removed);
+			}
+
+			// end() stays with its header, the other iterators follow their nodes
 			void swap (set& x)	{ 
-				node *tmp = root; 
-				node *tmp_nil = nil_node;
-				size_type st = _size;
-				root = x.root;
-				nil_node = x.nil_node;
-				_size = x._size;
-				x._size = st;
-				x.root = tmp;
-				x.nil_node = tmp_nil;	
+				debugInvalidate(header());
+				x.debugInvalidate(x.header());
+				debugSwap(x);
+				ft::swap(_header, x._header);
+				adoptHeader();
+				x.adoptHeader();
+				ft::swap(impl.get(), x.impl.get());
+				impl.swap(x.impl);
 			};
 
-			void clear() { deletedTree(); nil_node = new_node(); root = nil_node; };
+			void clear() { deletedTree(root()); resetHeader(); impl.release(); };
 
 /*Observers:-----------------------------------------------------------------------
 key_comp	Return key comparison object (public member function)				ok
 value_comp	Return value comparison object (public member function)-------------ok-*/
-			key_compare key_comp (void) const 		{	return (key_compare());			};
+			key_compare key_comp (void) const 		{	return (impl.get());			};
 
-			value_compare value_comp (void) const	{	return (value_compare(comp));	};
+			value_compare value_comp (void) const	{	return (value_compare(impl.get()));	};
 
 /*Operations:----------------------------------------------------------------------
 find	Get iterator to element (public member function)   						OK
@@ -314,80 +609,78 @@ count	Count elements with a specific key (public member function)
 lower_bound	Return iterator to lower bound (public member function)
 upper_bound	Return iterator to upper bound (public member function)
 equal_range	Get range of equal elements (public member function)-------------------*/
-		iterator	find(const value_type& val)
-        {
-			// value_type val = ft::make_pair( k, mapped_type() );
-			node *f = root;
-			while (!f->nil) 
-			{
-				if (comp(val, f->data))              	
-					f = f->left;
-				else if (comp(f->data, val))         	
-					f = f->right;
-				else					                        
-					return iterator(f);
-			}
-			return end();
-        }
+		iterator		find (const value_type& k)			{	return (iterator(findNode(k), this));	}
 
-		const_iterator find (const value_type& val) const
-		{
-			node *f = root;
-			while (!f->nil) 
-			{
-				if (comp(val, f->data))              	
-					f = f->left;
-				else if (comp(f->data, val))         	
-					f = f->right;
-				else					                        
-					return iterator(f);
-			}
-			return end();
-		}
+		const_iterator	find (const value_type& k) const	{	return (const_iterator(findNode(k), this));	}
 
-		size_type count (const value_type& k) const 
-		{ return (find(k).getPtr()->nil ? 0 : 1); };
+		size_type count (const value_type& k) const	{	return (findNode(k) == header() ? 0 : 1);	};
 
 		iterator lower_bound (const value_type& k)
-		{
-			iterator it = begin();
-			while (comp(*it, k) && it != end())
-				++it;
-			return (it);
-		}
+		{	return (iterator(lowerBoundNode(root(), header(), k), this));	}
 
 		const_iterator lower_bound (const value_type& k) const
-		{
-			const_iterator it = begin();
-			while (comp(*it, k) && it != end())
-				++it;
-			return (it);
-		}
+		{	return (const_iterator(lowerBoundNode(root(), header(), k), this));	}
 
 		iterator upper_bound (const value_type& k)
+		{	return (iterator(upperBoundNode(root(), header(), k), this));	}
+
+		const_iterator upper_bound (const value_type& k) const
+		{	return (const_iterator(upperBoundNode(root(), header(), k), this));	}
+
+		ft::pair<iterator,iterator> equal_range (const value_type & k)
 		{
-			iterator it = begin();
-			while (!comp(k, *it) && it != end())
-				++it;
-			return (it);
+			ft::pair<node *, node *> r = equalRangeNodes(k);
+			return (ft::make_pair(iterator(r.first, this), iterator(r.second, this)));
 		}
 
-		const_iterator upper_bound (const value_type& k) const
+		ft::pair<const_iterator,const_iterator> equal_range (const value_type & k) const
 		{
-			const_iterator it = begin();
-			while (!comp(k, *it) && it != end())
-				++it;
-			return (it);
+			ft::pair<node *, node *> r = equalRangeNodes(k);
+			return (ft::make_pair(const_iterator(r.first, this), const_iterator(r.second, this)));
 		}
 
-		ft::pair<iterator,iterator> equal_range (const value_type & k)
+		// Heterogeneous lookup: only offered when Compare declares is_transparent,
+		// so k is compared against the stored keys as is, without building a key.
+		template <class K>
+		iterator		find (const K& k, typename ft::enable_if<ft::is_transparent<Compare, K>::value>::type* = 0)
+		{	return (iterator(findNode(k), this));	}
+
+		template <class K>
+		const_iterator	find (const K& k, typename ft::enable_if<ft::is_transparent<Compare, K>::value>::type* = 0) const
+		{	return (const_iterator(findNode(k), this));	}
+
+		template <class K>
+		size_type count (const K& k, typename ft::enable_if<ft::is_transparent<Compare, K>::value>::type* = 0) const
+		{	return (findNode(k) == header() ? 0 : 1);	};
+
+		template <class K>
+		iterator lower_bound (const K& k, typename ft::enable_if<ft::is_transparent<Compare, K>::value>::type* = 0)
+		{	return (iterator(lowerBoundNode(root(), header(), k), this));	}
+
+		template <class K>
+		const_iterator lower_bound (const K& k, typename ft::enable_if<ft::is_transparent<Compare, K>::value>::type* = 0) const
+		{	return (const_iterator(lowerBoundNode(root(), header(), k), this));	}
+
+		template <class K>
+		iterator upper_bound (const K& k, typename ft::enable_if<ft::is_transparent<Compare, K>::value>::type* = 0)
+		{	return (iterator(upperBoundNode(root(), header(), k), this));	}
+
+		template <class K>
+		const_iterator upper_bound (const K& k, typename ft::enable_if<ft::is_transparent<Compare, K>::value>::type* = 0) const
+		{	return (const_iterator(upperBoundNode(root(), header(), k), this));	}
+
+		template <class K>
+		ft::pair<iterator,iterator> equal_range (const K & k, typename ft::enable_if<ft::is_transparent<Compare, K>::value>::type* = 0)
 		{
-			return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			ft::pair<node *, node *> r = equalRangeNodes(k);
+			return (ft::make_pair(iterator(r.first, this), iterator(r.second, this)));
 		}
 
-		ft::pair<const_iterator,const_iterator> equal_range (const value_type & k) const
+		template <class K>
+		ft::pair<const_iterator,const_iterator> equal_range (const K & k, typename ft::enable_if<ft::is_transparent<Compare, K>::value>::type* = 0) const
 		{
-			return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			ft::pair<node *, node *> r = equalRangeNodes(k);
+			return (ft::make_pair(const_iterator(r.first, this), const_iterator(r.second, this)));
 		}
 		
 /*Allocator:-----------------------------------------------------------------------
@@ -398,216 +691,225 @@ get_allocator	Get allocator (public member function)----------------------------
 		private:
 //88888888888888888888888888888888888888888888888888888888888888888888888888888888888888888
 
+			void replaceChild(node *x, node *y) {
+				if (x == root())
+					header()->setParent(y);
+				else if (x == x->parent()->left)
+					x->parent()->left = y;
+				else
+					x->parent()->right = y;
+			}
+
 			void rotateLeft(node *x) {
 				node *y = x->right;
 				x->right = y->left;
-				if (y->left != nil_node) y->left->parent = x;
-				if (y != nil_node) y->parent = x->parent;
-				if (x->parent) {
-					if (x == x->parent->left)
-						x->parent->left = y;
-					else
-						x->parent->right = y;
-				} else { root = y; }
+				if (y->left) y->left->setParent(x);
+				y->setParent(x->parent());
+				replaceChild(x, y);
 				y->left = x;
-				if (x != nil_node) x->parent = y;
+				x->setParent(y);
 			}
 
 			void rotateRight(node *x) {
 				node *y = x->left;
 				x->left = y->right;
-				if (y->right != nil_node) y->right->parent = x;
-				if (y != nil_node) y->parent = x->parent;
-				if (x->parent) {
-					if (x == x->parent->right)
-						x->parent->right = y;
-					else
-						x->parent->left = y;
-				} else { root = y; 	}
+				if (y->right) y->right->setParent(x);
+				y->setParent(x->parent());
+				replaceChild(x, y);
 				y->right = x;
-				if (x != nil_node) x->parent = y;
+				x->setParent(y);
 			}
 
+			static bool isBlack(node *x) { return (!x || x->color() == BLACK); }
+
 			void insertFixup(node *x) {
-				while (x != root && x->parent->color == RED) {
-					if (x->parent == x->parent->parent->left) {
-						node *y = x->parent->parent->right;
-						if (y->color == RED) {
-							x->parent->color = BLACK;
-							y->color = BLACK;
-							x->parent->parent->color = RED;
-							x = x->parent->parent;
+				while (x != root() && x->parent()->color() == RED) {
+					if (x->parent() == x->parent()->parent()->left) {
+						node *y = x->parent()->parent()->right;
+						if (!isBlack(y)) {
+							x->parent()->setColor(BLACK);
+							y->setColor(BLACK);
+							x->parent()->parent()->setColor(RED);
+							x = x->parent()->parent();
 						} else {
-							if (x == x->parent->right) {
-								x = x->parent;
+							if (x == x->parent()->right) {
+								x = x->parent();
 								rotateLeft(x);
 							}
-							x->parent->color = BLACK;
-							x->parent->parent->color = RED;
-							rotateRight(x->parent->parent);
+							x->parent()->setColor(BLACK);
+							x->parent()->parent()->setColor(RED);
+							rotateRight(x->parent()->parent());
 						}
 					} else {
-						node *y = x->parent->parent->left;
-						if (y->color == RED) {
-							x->parent->color = BLACK;
-							y->color = BLACK;
-							x->parent->parent->color = RED;
-							x = x->parent->parent;
+						node *y = x->parent()->parent()->left;
+						if (!isBlack(y)) {
+							x->parent()->setColor(BLACK);
+							y->setColor(BLACK);
+							x->parent()->parent()->setColor(RED);
+							x = x->parent()->parent();
 						} else {
-							if (x == x->parent->left) {
-								x = x->parent;
+							if (x == x->parent()->left) {
+								x = x->parent();
 								rotateRight(x);
 							}
-							x->parent->color = BLACK;
-							x->parent->parent->color = RED;
-							rotateLeft(x->parent->parent);
+							x->parent()->setColor(BLACK);
+							x->parent()->parent()->setColor(RED);
+							rotateLeft(x->parent()->parent());
 						}
 					}
 				}
-				root->color = BLACK;
+				root()->setColor(BLACK);
 			}
 
-			node *insertNode(const value_type& data) {
-				node *current, *parent, *x;
-				current = root;
-				parent = 0;
-				while (current != nil_node) {
-					if (equal_val(data, current->data)) return (current);
-					parent = current;
-					current = (comp(data, current->data) ? current->left : current->right);
+			/* One descent for k with a single comparison per level. Returns the
+			   node holding k, or NULL with the spot a new node would hang from
+			   left in parent/left. */
+			node *findSlot(const value_type & k, node *&parent, bool &left) {
+				parent = header();
+				left = true;
+				if (!empty() && comp(header()->right->data, k)) {	// ascending feed
+					parent = header()->right;
+					left = false;
+					return (NULL);
+				}
+				for (node *x = root(); x; x = (left ? x->left : x->right)) {
+					parent = x;
+					left = comp(k, x->data);
+				}
+				node *prev = parent;
+				if (left) {
+					if (parent == header()->left)
+						return (NULL);
+					prev = (--iterator(parent)).getPtr();
 				}
+				return (comp(prev->data, k) ? NULL : prev);
+			}
 
-				/* setup new node */
-				x = new_node(data);
-				x->parent = parent;
-				x->left = nil_node;
-				x->right = nil_node;
-				x->color = RED;
-
-				/* insert node in tree */
-				if(parent) {
-					if(comp(data, parent->data))
-						parent->left = x;
-					else
-						parent->right = x;
+			/* hang x under parent and keep the cached extremes up to date */
+			node *linkNode(node *parent, bool left, node *x) {
+				x->setParent(parent);
+				x->left = NULL;
+				x->right = NULL;
+				x->setColor(RED);
+				if (parent == header()) {
+					header()->setParent(x);
+					header()->left = x;
+					header()->right = x;
+				} else if (left) {
+					parent->left = x;
+					if (parent == header()->left)
+						header()->left = x;
 				} else {
-					root = x;
+					parent->right = x;
+					if (parent == header()->right)
+						header()->right = x;
 				}
-
 				insertFixup(x);
-				rightXod();
-				return(x);
-			}
-
-			void deleteFixup(node *x) {
-				while (x != root && x->color == BLACK) {
-					if (x == x->parent->left) {
-						node *w = x->parent->right;
-						if (w->color == RED) {
-							w->color = BLACK;
-							x->parent->color = RED;
-							rotateLeft (x->parent);
-							w = x->parent->right;
+				return (x);
+			}
+
+			void deleteFixup(node *x, node *x_parent) {
+				while (x != root() && isBlack(x)) {
+					if (x == x_parent->left) {
+						node *w = x_parent->right;
+						if (w->color() == RED) {
+							w->setColor(BLACK);
+							x_parent->setColor(RED);
+							rotateLeft (x_parent);
+							w = x_parent->right;
 						}
-						if (w->left->color == BLACK && w->right->color == BLACK) {
-							w->color = RED;
-							x = x->parent;
+						if (isBlack(w->left) && isBlack(w->right)) {
+							w->setColor(RED);
+							x = x_parent;
+							x_parent = x_parent->parent();
 						} else {
-							if (w->right->color == BLACK) {
-								w->left->color = BLACK;
-								w->color = RED;
+							if (isBlack(w->right)) {
+								w->left->setColor(BLACK);
+								w->setColor(RED);
 								rotateRight (w);
-								w = x->parent->right;
+								w = x_parent->right;
 							}
-							w->color = x->parent->color;
-							x->parent->color = BLACK;
-							w->right->color = BLACK;
-							rotateLeft (x->parent);
-							x = root;
+							w->setColor(x_parent->color());
+							x_parent->setColor(BLACK);
+							if (w->right) w->right->setColor(BLACK);
+							rotateLeft (x_parent);
+							break;
 						}
 					} else {
-						node *w = x->parent->left;
-						if (w->color == RED) {
-							w->color = BLACK;
-							x->parent->color = RED;
-							rotateRight (x->parent);
-							w = x->parent->left;
+						node *w = x_parent->left;
+						if (w->color() == RED) {
+							w->setColor(BLACK);
+							x_parent->setColor(RED);
+							rotateRight (x_parent);
+							w = x_parent->left;
 						}
-						if (w->right->color == BLACK && w->left->color == BLACK) {
-							w->color = RED;
-							x = x->parent;
+						if (isBlack(w->right) && isBlack(w->left)) {
+							w->setColor(RED);
+							x = x_parent;
+							x_parent = x_parent->parent();
 						} else {
-							if (w->left->color == BLACK) {
-								w->right->color = BLACK;
-								w->color = RED;
+							if (isBlack(w->left)) {
+								w->right->setColor(BLACK);
+								w->setColor(RED);
 								rotateLeft (w);
-								w = x->parent->left;
+								w = x_parent->left;
 							}
-							w->color = x->parent->color;
-							x->parent->color = BLACK;
-							w->left->color = BLACK;
-							rotateRight (x->parent);
-							x = root;
+							w->setColor(x_parent->color());
+							x_parent->setColor(BLACK);
+							if (w->left) w->left->setColor(BLACK);
+							rotateRight (x_parent);
+							break;
 						}
 					}
 				}
-				x->color = BLACK;
+				if (x) x->setColor(BLACK);
 			}
 
 			void deleteNode(node *z) {
-				node *x, *y;
-				if (!z || z == nil_node) return;
-				if (z->left == nil_node || z->right == nil_node) {
-					y = z;
-				} else {
-					y = z->right;
-					while (y->left != nil_node) y = y->left;
-				}
-
-				if (y->left != nil_node)
-					x = y->left;
-				else
+				node *x, *x_parent;
+				node *y = z;
+				if (!z || z == header()) return;
+				if (!z->left)
+					x = z->right;
+				else if (!z->right)
+					x = z->left;
+				else {
+					y = minimum(z->right);
 					x = y->right;
+				}
 
-				x->parent = y->parent;
-				if (y->parent)
-					if (y == y->parent->left)
-						y->parent->left = x;
-					else
-						y->parent->right = x;
-				else
-					root = x;
+				if (y != z) {
+					/* relink the successor y into z's place instead of copying data,
+					   so iterators to every other element stay valid */
+					z->left->setParent(y);
+					y->left = z->left;
+					if (y != z->right) {
+						x_parent = y->parent();
+						if (x) x->setParent(y->parent());
+						y->parent()->left = x;
+						y->right = z->right;
+						z->right->setParent(y);
+					} else
+						x_parent = y;
+					replaceChild(z, y);
+					y->setParent(z->parent());
+					bool c = y->color();
+					y->setColor(z->color());
+					z->setColor(c);
+				} else {
+					x_parent = z->parent();
+					if (x) x->setParent(z->parent());
+					replaceChild(z, x);
+					if (header()->left == z)
+						header()->left = (z->right ? minimum(x) : z->parent());
+					if (header()->right == z)
+						header()->right = (z->left ? maximum(x) : z->parent());
+				}
 
-				if (y != z) z = copy_data(z, y);
-				// if (y != z) z->data = y->data;
-				
-				if (y->color == BLACK && x != nil_node) 	deleteFixup (x);
-				rightXod();
-				if (y != nil_node) destroyNode(y);
+				if (z->color() == BLACK) deleteFixup (x, x_parent);
+				destroyNode(z);
 			}
 
-			node *copy_data(node * a, node * b)
-			{
-				if (a->nil || a == b) return a; 
-				node *c = new_node(b->data);
-				c->parent = a->parent;
-				c->left = a->left;
-				c->right = a->right;
-				c->nil = a->nil;
-				c->color = a->color;
-				if (a->left->parent == a) a->left->parent = c;
-				if (a->right->parent == a) a->right->parent = c;
-				if (a->parent)
-					(a->parent->left == a ? a->parent->left = c : a->parent->right = c);
-				if (root == a)
-					root = c;
-				destroyNode(a);
-				return c;
-			}
-
-			bool equal_val (const value_type & lhs, const value_type & rhs) const
-			{ return (comp(lhs, rhs) == false && comp(rhs, lhs) == false);	}
-
 //88888888888888888888888888888888888888888888888888888888888888888888888888888888888
 //END RBtree =================================================================================
 
@@ -644,6 +946,10 @@ get_allocator	Get allocator (public member function)----------------------------
 	void swap (set<T,Compare,Alloc> & x, set<T,Compare,Alloc> & y)
 	{	x.swap(y);	}
 
+	template <class T, class Compare, class Alloc, class Predicate>
+	typename set<T,Compare,Alloc>::size_type erase_if (set<T,Compare,Alloc> & c, Predicate pred)
+	{	return (c.erase_if(pred));	}
+
 
 } // endnamespace ft
 
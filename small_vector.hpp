@@ -0,0 +1,175 @@
+#ifndef SMALL_VECTOR_HPP
+# define SMALL_VECTOR_HPP
+
+# include "vector.hpp"
+
+# if __cplusplus >= 201103L
+#  include <type_traits>
+# endif
+
+    namespace   ft {
+
+    // A vector that keeps up to N elements inside the object itself and only
+    // goes to the allocator once it holds more. Same interface, iterators
+    // and growth policies as ft::vector, whose algorithms it shares
+    // (VectorBase.hpp); iterators, pointers and references are invalidated by
+    // any operation that would do so for ft::vector, and also by swap and
+    // move construction while the elements are stored inline.
+    template<typename T, std::size_t N, typename A = std::allocator<T>, typename G = ft::growth_double>
+// class SMALL_VECTOR **********************************************************
+    class small_vector : private ft::vector_base<T, A, G, N> {
+
+        public :
+            typedef	T														value_type;
+			typedef A   													allocator_type;
+			typedef G														growth_policy_type;
+
+			typedef typename allocator_type::reference						reference;
+			typedef typename allocator_type::const_reference				const_reference;
+			typedef typename allocator_type::pointer						pointer;
+			typedef typename allocator_type::const_pointer					const_pointer;
+
+			typedef ft::iterator< T >										iterator;
+			typedef ft::iterator< const T >									const_iterator;
+			typedef ft::reverse_iterator<iterator>							reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+			typedef typename iterator_traits<iterator>::difference_type		difference_type;
+			typedef size_t													size_type;
+
+            static const size_type inline_capacity = N;
+
+        private:
+
+            typedef ft::vector_base<T, A, G, N>                             base_type;
+            using base_type::_alloc;
+            using base_type::arr;
+            using base_type::_size;
+
+        public:
+// CONSTRUCTORS-------------------------------------------------------------------
+
+            explicit	small_vector( const allocator_type& alloc = allocator_type() )	:	base_type(alloc)  {}
+
+			explicit	small_vector( size_type n, const value_type& val = value_type(),
+							const allocator_type& alloc = allocator_type() )    : base_type(alloc)
+            {   insert(begin(), n, val);    }
+
+			template <class InputIterator>
+			small_vector( InputIterator first, InputIterator last,
+                const allocator_type& alloc = allocator_type(),
+                typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)	:  base_type(alloc)
+            {   insert(begin(), first, last);   }
+
+			small_vector( const small_vector& x )	:	base_type(x._alloc)
+            {
+                reserve(x._size);
+                _size = this->uninitializedCopy(x.arr, x.arr + x._size, arr) - arr;
+            }
+
+# if __cplusplus >= 201103L
+            // a heap buffer is taken over; inline elements have to be moved
+            small_vector( small_vector&& x ) noexcept(std::is_nothrow_move_constructible<T>::value)
+                : base_type(std::move(x._alloc), x.growth_policy())
+            {   this->moveConstruct(x);    }
+
+            small_vector&			operator = (small_vector&& x)
+            {
+                if (this != &x)
+                    this->moveAssign(x);
+                return *this;
+            }
+# endif
+
+			small_vector&			operator = (const small_vector& x)
+			{
+                if (this != &x)
+                    this->assignFrom(x);
+				return *this;
+			}
+
+// Element access:--------------------------------------------------------------
+        using base_type::operator[];
+        using base_type::at;
+        using base_type::front;
+        using base_type::back;
+        using base_type::data;
+
+//==============================================================================
+
+// Capacity:--------------------------------------------------------------------
+        using base_type::size;
+        using base_type::max_size;
+        using base_type::resize;
+        using base_type::capacity;
+        using base_type::empty;
+        using base_type::reserve;
+        using base_type::shrink_to_fit;
+
+        // true while the elements live inside the object
+        bool is_inline() const  { return (this->isInline()); }
+
+//==============================================================================
+
+// Modifiers:-------------------------------------------------------------------
+        using base_type::assign;
+        using base_type::push_back;
+        using base_type::pop_back;
+# if __cplusplus >= 201103L
+        using base_type::emplace_back;
+        using base_type::emplace;
+# endif
+        using base_type::insert;
+        using base_type::erase;
+        using base_type::erase_if;
+        using base_type::clear;
+
+        // O(1) when both buffers are on the heap, otherwise the elements are
+        // exchanged through a temporary
+        void swap( small_vector& other ) {
+            if (this == &other)
+                return;
+            if (!is_inline() && !other.is_inline())
+            {
+                this->swapBuffers(other);
+                return;
+            }
+            small_vector tmp(other);
+            other = *this;
+            *this = tmp;
+        }
+
+ // ============================================================================
+
+// Iterators:-------------------------------------------------------------------
+        using base_type::begin;
+        using base_type::end;
+        using base_type::rbegin;
+        using base_type::rend;
+//==============================================================================
+
+// ALLOCATOR:-------------------------------------------------------------------
+        using base_type::get_allocator;
+//==============================================================================
+
+// GROWTH POLICY:---------------------------------------------------------------
+        using base_type::growth_policy;
+//==============================================================================
+    };
+// END CLASS SMALL_VECTOR ******************************************************
+
+    // compared through the operators in VectorBase.hpp
+    template <class T, std::size_t N, class Alloc, class G>
+    struct is_vector_like< small_vector<T,N,Alloc,G> > : public true_type {};
+
+	template <class T, std::size_t N, class Alloc, class G>
+	void	swap(small_vector<T,N,Alloc,G>& x, small_vector<T,N,Alloc,G>& y)
+    {	x.swap(y);				};
+
+	template <class T, std::size_t N, class Alloc, class G, class Predicate>
+	typename small_vector<T,N,Alloc,G>::size_type	erase_if(small_vector<T,N,Alloc,G>& c, Predicate pred)
+    {	return c.erase_if(pred);	};
+
+
+} // endnamespace ft
+
+#endif
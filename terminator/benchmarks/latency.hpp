@@ -0,0 +1,76 @@
+#pragma once
+
+#include <time.h>
+#include <iostream>
+
+// Per-operation latencies in power-of-two nanosecond buckets, for looking at
+// the tail rather than the total. Percentiles are reported as the upper
+// bound of the bucket they fall in; the maximum is exact.
+class latency_histogram
+{
+public:
+    enum { BUCKETS = 64 };
+
+    latency_histogram() : count(0), worst(0)
+    {
+        for (int i = 0; i < BUCKETS; ++i) {
+            buckets[i] = 0;
+        }
+    }
+
+    static long now()
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec * 1000000000L + ts.tv_nsec;
+    }
+
+    void add(long ns)
+    {
+        int b = 0;
+        while (b < BUCKETS - 1 && (1L << b) < ns) {
+            ++b;
+        }
+        ++buckets[b];
+        ++count;
+        if (ns > worst) {
+            worst = ns;
+        }
+    }
+
+    // upper bound of the bucket holding the p-th fraction of the samples
+    long percentile(double p) const
+    {
+        long wanted = (long)(p * count);
+        long seen = 0;
+        for (int b = 0; b < BUCKETS; ++b) {
+            seen += buckets[b];
+            if (seen > wanted) {
+                return 1L << b;
+            }
+        }
+        return worst;
+    }
+
+    long max() const { return worst; }
+
+    void print_summary(const char* name) const
+    {
+        std::cout << name << ": p50 <= " << percentile(0.5) << "ns, p99.9 <= " << percentile(0.999)
+                  << "ns, max " << worst << "ns" << std::endl;
+    }
+
+    void print_buckets() const
+    {
+        for (int b = 0; b < BUCKETS; ++b) {
+            if (buckets[b] != 0) {
+                std::cout << "  <= " << (1L << b) << "ns: " << buckets[b] << std::endl;
+            }
+        }
+    }
+
+private:
+    long buckets[BUCKETS];
+    long count;
+    long worst;
+};
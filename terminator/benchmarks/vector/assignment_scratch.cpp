@@ -0,0 +1,33 @@
+#include "vector_prelude.hpp"
+
+#include <string>
+
+// A scratch vector reassigned from each incoming message: once it has seen
+// the biggest message it should never allocate again, and strings assigned
+// over keep their buffers.
+#define MESSAGES (MAXSIZE / 16)
+
+template <typename T>
+void run(const char* name, const T& val)
+{
+    SETUP;
+
+    NAMESPACE::vector<NAMESPACE::vector<T> > msgs;
+    for (std::size_t i = 0; i < 64; ++i) {
+        msgs.push_back(NAMESPACE::vector<T>(rand() % 32 + 1, val));
+    }
+
+    timer t;
+    NAMESPACE::vector<T> scratch;
+    for (std::size_t i = 0; i < MESSAGES; ++i) {
+        scratch = msgs[i % msgs.size()];
+        sum += scratch.size();
+    }
+    std::cout << name << ": " << t.get_time() << "ms" << (sum ? "" : " ") << std::endl;
+}
+
+int main()
+{
+    run<int>("int", 42);
+    run<std::string>("string", std::string(64, 'x'));
+}
@@ -0,0 +1,91 @@
+#include "vector_prelude.hpp"
+
+#include <algorithm>
+
+// Bulk work on large vector<bool> bitmaps: population count, and-ing two
+// maps, walking the set bits and comparing. ft::vector<bool> does each a
+// word at a time; std::vector<bool> gets the generic algorithms.
+#define BITS (MAXSIZE / 4)
+
+template <typename V>
+std::size_t count(const V& v)
+{
+    return std::count(v.begin(), v.end(), true);
+}
+
+std::size_t count(const ft::vector<bool>& v)
+{
+    return v.count();
+}
+
+template <typename V>
+void and_with(V& v, const V& x)
+{
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        v[i] = v[i] && x[i];
+    }
+}
+
+void and_with(ft::vector<bool>& v, const ft::vector<bool>& x)
+{
+    v &= x;
+}
+
+template <typename V>
+std::size_t walk(const V& v)
+{
+    std::size_t sum = 0;
+    for (typename V::const_iterator it = std::find(v.begin(), v.end(), true); it != v.end();
+         it = std::find(it + 1, v.end(), true)) {
+        sum += it - v.begin();
+    }
+    return sum;
+}
+
+std::size_t walk(const ft::vector<bool>& v)
+{
+    std::size_t sum = 0;
+    for (std::size_t i = v.find_first(); i < v.size(); i = v.find_next(i)) {
+        sum += i;
+    }
+    return sum;
+}
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::vector<bool> a, b;
+    for (std::size_t i = 0; i < BITS; ++i) {
+        a.push_back(rand() % 2);
+        b.push_back(rand() % 64 == 0);
+    }
+
+    timer t;
+    for (int i = 0; i < 20; ++i) {
+        sum += count(a);
+    }
+    std::cout << "count: " << t.get_time() << "ms" << std::endl;
+
+    t.reset();
+    for (int i = 0; i < 20; ++i) {
+        NAMESPACE::vector<bool> c(a);
+        and_with(c, b);
+        sum += c[i];
+    }
+    std::cout << "and: " << t.get_time() << "ms" << std::endl;
+
+    t.reset();
+    for (int i = 0; i < 20; ++i) {
+        sum += walk(b);
+    }
+    std::cout << "find: " << t.get_time() << "ms" << std::endl;
+
+    t.reset();
+    for (int i = 0; i < 20; ++i) {
+        NAMESPACE::vector<bool> c(a);
+        c[BITS - 1 - i] = !c[BITS - 1 - i];
+        sum += (a == c) + (a < c);
+    }
+    std::cout << "compare: " << t.get_time() << "ms" << (sum ? "" : " ") << std::endl;
+}
@@ -0,0 +1,40 @@
+#include "small_vector.hpp"
+#include "vector_prelude.hpp"
+
+// Copies of a short vector: one allocation each for NAMESPACE::vector, none
+// for ft::small_vector<int, 8> as long as the elements fit inline.
+#define SMALL_ROUNDS (MAXSIZE / 8)
+
+template <typename Vector, std::size_t Len>
+long run()
+{
+    SETUP;
+
+    Vector v;
+    for (std::size_t i = 0; i < Len; ++i) {
+        v.push_back(rand());
+    }
+
+    timer t;
+    for (std::size_t r = 0; r < SMALL_ROUNDS; ++r) {
+        Vector c(v);
+
+        BLOCK_OPTIMIZATION(c);
+    }
+    return t.get_time();
+}
+
+template <std::size_t Len>
+void report()
+{
+    std::cout << Len << " elements, vector: " << run<NAMESPACE::vector<int>, Len>()
+              << "ms, small_vector<8>: " << run<ft::small_vector<int, 8>, Len>() << "ms" << std::endl;
+}
+
+int main()
+{
+    report<2>();
+    report<4>();
+    report<8>();
+    report<16>();
+}
@@ -0,0 +1,32 @@
+#include "vector_prelude.hpp"
+
+// The push_back workload once per ft growth policy, with what each one cost
+// in reallocations and copying. Always runs ft::vector, whatever NAMESPACE.
+
+template <typename Policy>
+void run(const char* name)
+{
+    SETUP;
+
+    timer t;
+    ft::vector<int, std::allocator<int>, ft::growth_stats<Policy> > v;
+
+    for (std::size_t i = 0; i < MAXSIZE; ++i) {
+        v.push_back(rand());
+    }
+
+    BLOCK_OPTIMIZATION(v);
+
+    std::cout << name << ": " << t.get_time() << "ms, " << v.growth_policy().reallocations()
+              << " reallocations, " << (v.growth_policy().bytes_copied() >> 20)
+              << "MiB copied, peak capacity " << v.growth_policy().peak_capacity() << std::endl;
+}
+
+int main()
+{
+    run<ft::growth_double>("2x");
+    run<ft::growth_half>("1.5x");
+    run<ft::growth_page_rounded<> >("2x page rounded");
+    run<ft::growth_size_class<> >("2x size class");
+    run<ft::growth_size_class<ft::growth_half> >("1.5x size class");
+}
@@ -0,0 +1,72 @@
+#include "packed_vector.hpp"
+#include "vector_prelude.hpp"
+
+// A column of 12-bit values as a plain vector<unsigned> and as an
+// ft::packed_vector<12> (3/8 of the memory): summing it in order (the
+// packed one through unpack() into a small buffer, then through get()) and
+// at random positions. The packed side is ft whatever NAMESPACE.
+#define COLUMN (MAXSIZE / 16)
+#define PROBES (MAXSIZE / 16)
+#define BLOCK 1024
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::vector<unsigned> plain;
+    ft::packed_vector<12> packed;
+    for (std::size_t i = 0; i < COLUMN; ++i) {
+        unsigned v = rand() % 4096;
+        plain.push_back(v);
+        packed.push_back(v);
+    }
+    NAMESPACE::vector<std::size_t> idx;
+    for (std::size_t i = 0; i < PROBES; ++i) {
+        idx.push_back(rand() % COLUMN);
+    }
+
+    timer t;
+    for (int r = 0; r < 10; ++r) {
+        for (std::size_t i = 0; i < COLUMN; ++i) {
+            sum += plain[i];
+        }
+    }
+    std::cout << "scan vector: " << t.get_time() << "ms" << std::endl;
+
+    t.reset();
+    unsigned buf[BLOCK];
+    for (int r = 0; r < 10; ++r) {
+        for (std::size_t i = 0; i < COLUMN; i += BLOCK) {
+            std::size_t n = COLUMN - i < BLOCK ? COLUMN - i : BLOCK;
+            packed.unpack(i, n, buf);
+            for (std::size_t j = 0; j < n; ++j) {
+                sum += buf[j];
+            }
+        }
+    }
+    std::cout << "scan packed unpack: " << t.get_time() << "ms" << std::endl;
+
+    t.reset();
+    for (int r = 0; r < 10; ++r) {
+        for (std::size_t i = 0; i < COLUMN; ++i) {
+            sum += packed.get(i);
+        }
+    }
+    std::cout << "scan packed get: " << t.get_time() << "ms" << std::endl;
+
+    t.reset();
+    for (int r = 0; r < 10; ++r) {
+        for (std::size_t i = 0; i < PROBES; ++i) {
+            sum += plain[idx[i]];
+        }
+    }
+    std::cout << "random vector: " << t.get_time() << "ms" << std::endl;
+
+    t.reset();
+    for (int r = 0; r < 10; ++r) {
+        for (std::size_t i = 0; i < PROBES; ++i) {
+            sum += packed.get(idx[i]);
+        }
+    }
+    std::cout << "random packed: " << t.get_time() << "ms" << (sum ? "" : " ") << std::endl;
+}
@@ -0,0 +1,32 @@
+#include "incremental_vector.hpp"
+#include "latency.hpp"
+#include "vector_prelude.hpp"
+
+// Full push_back latency histograms: the vector's worst case grows with its
+// size (the whole buffer is copied), ft::incremental_vector's does not.
+#define LATENCY_SIZE (MAXSIZE / 4)
+
+template <typename Vector>
+void run(const char* name)
+{
+    SETUP;
+
+    latency_histogram h;
+    Vector v;
+
+    for (std::size_t i = 0; i < LATENCY_SIZE; ++i) {
+        long start = latency_histogram::now();
+        v.push_back(static_cast<int>(i));
+        h.add(latency_histogram::now() - start);
+    }
+
+    BLOCK_OPTIMIZATION(v);
+    h.print_summary(name);
+    h.print_buckets();
+}
+
+int main()
+{
+    run<NAMESPACE::vector<int> >("vector");
+    run<ft::incremental_vector<int> >("incremental_vector");
+}
@@ -0,0 +1,43 @@
+#include "mremap_allocator.hpp"
+#include "vector_prelude.hpp"
+#include <sys/resource.h>
+
+// Grows a vector of ints to MAXRAM bytes (2GB) with push_back. With
+// ft::mremap_allocator the big buffers grow through mremap, so the data is
+// never copied and the old and new buffer never coexist; with the default
+// allocator each reallocation copies everything and briefly needs both.
+// Peak RSS is per process, so the mremap run goes first. Always runs
+// ft::vector, whatever NAMESPACE.
+
+long peak_rss_mb()
+{
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss / 1024;
+}
+
+template <typename Vector>
+void run(const char* name)
+{
+    SETUP;
+
+    timer t;
+    {
+        Vector v;
+
+        for (std::size_t i = 0; i < MAXSIZE; ++i) {
+            v.push_back(static_cast<int>(i));
+        }
+
+        BLOCK_OPTIMIZATION(v);
+        std::cout << name << ": " << t.get_time() << "ms, " << v.growth_policy().reallocations()
+                  << " reallocations, " << (v.growth_policy().bytes_copied() >> 20)
+                  << "MiB copied, peak RSS " << peak_rss_mb() << "MiB" << std::endl;
+    }
+}
+
+int main()
+{
+    run<ft::vector<int, ft::mremap_allocator<int>, ft::growth_stats<> > >("mremap_allocator");
+    run<ft::vector<int, std::allocator<int>, ft::growth_stats<> > >("std::allocator");
+}
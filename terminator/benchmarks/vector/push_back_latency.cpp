@@ -0,0 +1,34 @@
+#include "incremental_vector.hpp"
+#include "latency.hpp"
+#include "segmented_vector.hpp"
+#include "vector_prelude.hpp"
+
+// Time of every single push_back, to compare the tail: a vector pays for its
+// reallocations in the few calls that trigger them, ft::segmented_vector
+// only ever adds a chunk and ft::incremental_vector moves two elements.
+#define LATENCY_SIZE (MAXSIZE / 4)
+
+template <typename Vector>
+void run(const char* name)
+{
+    SETUP;
+
+    latency_histogram h;
+    Vector v;
+
+    for (std::size_t i = 0; i < LATENCY_SIZE; ++i) {
+        long start = latency_histogram::now();
+        v.push_back(static_cast<int>(i));
+        h.add(latency_histogram::now() - start);
+    }
+
+    BLOCK_OPTIMIZATION(v);
+    h.print_summary(name);
+}
+
+int main()
+{
+    run<NAMESPACE::vector<int> >("vector");
+    run<ft::segmented_vector<int> >("segmented_vector");
+    run<ft::incremental_vector<int> >("incremental_vector");
+}
@@ -0,0 +1,39 @@
+#include "small_vector.hpp"
+#include "vector_prelude.hpp"
+
+// Many short-lived vectors of a few elements: with NAMESPACE::vector each one
+// costs an allocation, ft::small_vector<int, 8> keeps them inline.
+#define SMALL_ROUNDS (MAXSIZE / 8)
+
+template <typename Vector, std::size_t Len>
+long run()
+{
+    SETUP;
+
+    timer t;
+    for (std::size_t r = 0; r < SMALL_ROUNDS; ++r) {
+        Vector v;
+
+        for (std::size_t i = 0; i < Len; ++i) {
+            v.push_back(static_cast<int>(r + i));
+        }
+
+        BLOCK_OPTIMIZATION(v);
+    }
+    return t.get_time();
+}
+
+template <std::size_t Len>
+void report()
+{
+    std::cout << Len << " elements, vector: " << run<NAMESPACE::vector<int>, Len>()
+              << "ms, small_vector<8>: " << run<ft::small_vector<int, 8>, Len>() << "ms" << std::endl;
+}
+
+int main()
+{
+    report<2>();
+    report<4>();
+    report<8>();
+    report<16>();
+}
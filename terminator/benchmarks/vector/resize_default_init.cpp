@@ -0,0 +1,56 @@
+#include "vector_prelude.hpp"
+
+// Refilling a vector with decoded data: resize(n) writes every element
+// before the decoder overwrites it, resize_default_init(n) leaves the ints
+// alone. Then the fill kernels: memset for a byte pattern (0, -1), plain
+// stores otherwise. Always runs ft::vector, whatever NAMESPACE.
+#define FILL_SIZE (MAXSIZE / 64)
+
+template <bool DefaultInit>
+void decode(const char* name, const NAMESPACE::vector<int>& src)
+{
+    SETUP;
+
+    ft::vector<int> v;
+    v.reserve(FILL_SIZE);
+
+    timer t;
+    for (int i = 0; i < 100; ++i) {
+        v.clear();
+        if (DefaultInit) {
+            v.resize_default_init(FILL_SIZE);
+        } else {
+            v.resize(FILL_SIZE);
+        }
+        for (std::size_t j = 0; j < FILL_SIZE; ++j) {
+            v[j] = src[j] ^ i;
+        }
+
+        BLOCK_OPTIMIZATION(v);
+    }
+    std::cout << name << ": " << t.get_time() << "ms" << std::endl;
+}
+
+void fill(const char* name, int val)
+{
+    SETUP;
+
+    timer t;
+    ft::vector<int> v(FILL_SIZE, val);
+    for (int i = 0; i < 100; ++i) {
+        v.assign(FILL_SIZE, val);
+        BLOCK_OPTIMIZATION(v);
+    }
+    std::cout << name << ": " << t.get_time() << "ms" << std::endl;
+}
+
+int main()
+{
+    NAMESPACE::vector<int> src(FILL_SIZE, 64);
+
+    decode<false>("resize + decode", src);
+    decode<true>("resize_default_init + decode", src);
+    fill("fill 0", 0);
+    fill("fill -1", -1);
+    fill("fill 1000", 1000);
+}
@@ -0,0 +1,42 @@
+#include "vector_prelude.hpp"
+
+// Element-wise loops through operator[]. It is unchecked, so these should
+// vectorize like they do on std::vector; check with
+//   g++ -O3 -fopt-info-vec-optimized ... subscript.cpp
+// which reports "loop vectorized" for add() and dot().
+#define SUBSCRIPT_SIZE (MAXSIZE / 16)
+
+void add(NAMESPACE::vector<float>& out, const NAMESPACE::vector<float>& a,
+         const NAMESPACE::vector<float>& b, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+int dot(const NAMESPACE::vector<int>& a, const NAMESPACE::vector<int>& b)
+{
+    int s = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        s += a[i] * b[i];
+    }
+    return s;
+}
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::vector<float> fa(SUBSCRIPT_SIZE, 1.5f), fb(SUBSCRIPT_SIZE, 2.5f), fout(SUBSCRIPT_SIZE);
+    NAMESPACE::vector<int> ia(SUBSCRIPT_SIZE, rand()), ib(SUBSCRIPT_SIZE, 3);
+
+    timer t;
+
+    for (int i = 0; i < 20; ++i) {
+        add(fout, fa, fb, SUBSCRIPT_SIZE);
+        x = x + dot(ia, ib);
+    }
+
+    BLOCK_OPTIMIZATION(fout);
+    PRINT_TIME(t);
+}
@@ -57,6 +57,18 @@ int main()
     vec_test_resize();
     vec_test_swap();
     vec_test_random();
+    vec_test_erase_if();
+    vec_test_emplace();
+    vec_test_move();
+    vec_test_growth_policy();
+    vec_test_shrink_to_fit();
+    vec_test_release_storage();
+    vec_test_small_vector();
+    vec_test_segmented_vector();
+    vec_test_incremental_vector();
+    vec_test_resize_default_init();
+    vec_test_vector_bool();
+    vec_test_packed_vector();
 
     stack_check_typedefs();
     stack_test_comparisons_eq();
@@ -100,6 +112,12 @@ int main()
     map_test_comparisons_lt();
     map_test_comparisons_le();
     map_test_compare();
+    map_test_reserve();
+    map_test_try_emplace();
+    map_test_insert_or_assign();
+    map_test_upsert();
+    map_test_transparent_lookup();
+    map_test_erase_if();
 
     set_check_typedefs();
     set_test_ctor();
@@ -133,4 +151,7 @@ int main()
     set_test_comparisons_ge();
     set_test_random();
     set_test_compare();
+    set_test_reserve();
+    set_test_transparent_lookup();
+    set_test_erase_if();
 }
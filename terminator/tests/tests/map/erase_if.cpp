@@ -0,0 +1,81 @@
+#include "map_prelude.hpp"
+
+namespace {
+
+struct odd_key {
+    template <typename Pair>
+    bool operator()(const Pair& p) const
+    {
+        return p.first % 2 != 0;
+    }
+};
+
+struct value_starts_with_digit {
+    template <typename Pair>
+    bool operator()(const Pair& p) const
+    {
+        return !p.second.empty() && p.second[0] >= '0' && p.second[0] <= '9';
+    }
+};
+
+// std::erase_if is C++20; the std side walks the map and erases as it goes
+template <typename Map, typename Predicate>
+typename Map::size_type map_erase_if(Map& m, Predicate pred)
+{
+    typename Map::size_type old_size = m.size();
+
+    for (typename Map::iterator it = m.begin(); it != m.end();) {
+        if (pred(*it)) {
+            m.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+    return old_size - m.size();
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc, typename Predicate>
+typename ft::map<Key, T, Compare, Alloc>::size_type map_erase_if(ft::map<Key, T, Compare, Alloc>& m,
+                                                                 Predicate pred)
+{
+    return ft::erase_if(m, pred);
+}
+
+} // namespace
+
+void map_test_erase_if()
+{
+    SETUP_ARRAYS();
+
+    {
+        intmap m(intstr_arr, intstr_arr + intstr_size);
+
+        PRINT_LINE("Erased:", map_erase_if(m, odd_key()));
+        PRINT_ALL(m);
+
+        PRINT_LINE("Erased:", map_erase_if(m, odd_key()));
+        PRINT_ALL(m);
+
+        PRINT_LINE("Erased:", map_erase_if(m, value_starts_with_digit()));
+        PRINT_ALL(m);
+
+        m.insert(intstr_arr, intstr_arr + 10);
+
+        PRINT_LINE("Erased:", map_erase_if(m, odd_key()));
+        PRINT_ALL(m);
+    }
+
+    {
+        strmap m;
+
+        PRINT_LINE("Erased:", map_erase_if(m, value_starts_with_digit()));
+        PRINT_ALL(m);
+
+        m.insert(strstr_arr, strstr_arr + strstr_size);
+
+        PRINT_LINE("Erased:", map_erase_if(m, value_starts_with_digit()));
+        PRINT_ALL(m);
+    }
+}
+
+MAIN(map_test_erase_if)
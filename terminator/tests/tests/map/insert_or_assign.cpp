@@ -0,0 +1,64 @@
+#include "map_prelude.hpp"
+
+// insert_or_assign() is C++17; C++98 std::map gets the same effect from lower_bound + hinted insert
+template <typename Map>
+static typename Map::iterator map_insert_or_assign(Map& m, const typename Map::key_type& k,
+                                                   const typename Map::mapped_type& obj,
+                                                   bool& inserted)
+{
+    typename Map::iterator it = m.lower_bound(k);
+
+    inserted = it == m.end() || m.key_comp()(k, it->first);
+    if (inserted) {
+        it = m.insert(it, typename Map::value_type(k, obj));
+    } else {
+        it->second = obj;
+    }
+    return it;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+static typename ft::map<Key, T, Compare, Alloc>::iterator
+map_insert_or_assign(ft::map<Key, T, Compare, Alloc>& m, const Key& k, const T& obj, bool& inserted)
+{
+    ft::pair<typename ft::map<Key, T, Compare, Alloc>::iterator, bool> ret =
+        m.insert_or_assign(k, obj);
+
+    inserted = ret.second;
+    return ret.first;
+}
+
+void map_test_insert_or_assign()
+{
+    SETUP_ARRAYS();
+
+    {
+        intmap m(intstr_arr, intstr_arr + 20);
+        bool inserted;
+
+        for (std::size_t i = 10; i < 30; ++i) {
+            intmap::iterator it =
+                map_insert_or_assign(m, intstr_arr[i].first, strstr_arr[i].second, inserted);
+
+            PRINT_PAIR_REF(*it);
+            PRINT_LINE("Inserted:", inserted);
+        }
+
+        PRINT_ALL(m);
+    }
+
+    {
+        strmap m;
+        bool inserted;
+
+        for (std::size_t i = 0; i < strstr_size; ++i) {
+            map_insert_or_assign(m, strstr_arr[i % 8].first, strstr_arr[i].second, inserted);
+
+            PRINT_LINE("Inserted:", inserted);
+        }
+
+        PRINT_ALL(m);
+    }
+}
+
+MAIN(map_test_insert_or_assign)
@@ -45,3 +45,9 @@ void map_test_comparisons_ge();
 void map_test_comparisons_lt();
 void map_test_comparisons_le();
 void map_test_compare();
+void map_test_reserve();
+void map_test_try_emplace();
+void map_test_insert_or_assign();
+void map_test_upsert();
+void map_test_transparent_lookup();
+void map_test_erase_if();
@@ -0,0 +1,76 @@
+#include "map_prelude.hpp"
+
+// reserve() is an ft extension; std::map has nothing to prepare
+template <typename Map>
+static void map_reserve(Map&, std::size_t)
+{
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+static void map_reserve(ft::map<Key, T, Compare, Alloc>& m, std::size_t n)
+{
+    m.reserve(n);
+}
+
+void map_test_reserve()
+{
+    SETUP_ARRAYS();
+
+    {
+        intmap m;
+
+        map_reserve(m, intstr_size);
+
+        m.insert(intstr_arr, intstr_arr + intstr_size);
+
+        PRINT_ALL(m);
+
+        map_reserve(m, 10);
+
+        m.erase(m.begin(), m.end());
+
+        PRINT_ALL(m);
+
+        map_reserve(m, 100);
+
+        m.insert(intstr_arr, intstr_arr + 20);
+
+        PRINT_ALL(m);
+
+        m.clear();
+
+        PRINT_ALL(m);
+
+        m.insert(intstr_arr + 5, intstr_arr + 40);
+
+        PRINT_ALL(m);
+    }
+
+    {
+        strmap m(strstr_arr, strstr_arr + strstr_size);
+
+        map_reserve(m, 64);
+
+        for (std::size_t i = 0; i < strstr_size; i += 2) {
+            m.erase(strstr_arr[i].first);
+        }
+
+        PRINT_ALL(m);
+
+        strmap small(strstr_arr, strstr_arr + 3);
+
+        m = small;
+
+        PRINT_ALL(m);
+
+        m = strmap();
+
+        PRINT_ALL(m);
+
+        m = strmap(strstr_arr, strstr_arr + strstr_size);
+
+        PRINT_ALL(m);
+    }
+}
+
+MAIN(map_test_reserve)
@@ -0,0 +1,88 @@
+#include "map_prelude.hpp"
+
+namespace {
+
+// a key that can't be built implicitly from its id, so looking it up by id only
+// compiles through the heterogeneous overloads
+struct badge {
+    explicit badge(int id) : id(id)
+    {
+    }
+
+    int id;
+};
+
+std::ostream& operator<<(std::ostream& os, const badge& b)
+{
+    return os << "#" << b.id;
+}
+
+struct badge_less {
+    typedef void is_transparent;
+
+    bool operator()(const badge& lhs, const badge& rhs) const
+    {
+        return lhs.id < rhs.id;
+    }
+
+    bool operator()(const badge& lhs, int rhs) const
+    {
+        return lhs.id < rhs;
+    }
+
+    bool operator()(int lhs, const badge& rhs) const
+    {
+        return lhs < rhs.id;
+    }
+};
+
+// C++98 std::map has no heterogeneous lookup, so the std side builds the key
+template <typename Map>
+typename Map::key_type lookup_key(const Map&, int id)
+{
+    return typename Map::key_type(id);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+int lookup_key(const ft::map<Key, T, Compare, Alloc>&, int id)
+{
+    return id;
+}
+
+} // namespace
+
+void map_test_transparent_lookup()
+{
+    typedef NAMESPACE::map<badge, std::string, badge_less,
+                           track_allocator<NAMESPACE::pair<const badge, std::string> > >
+        badgemap;
+
+    SETUP_ARRAYS();
+
+    badgemap m;
+
+    for (std::size_t i = 0; i < intstr_size; i += 2) {
+        m.insert(NAMESPACE::make_pair(badge(static_cast<int>(i)), intstr_arr[i].second));
+    }
+
+    const badgemap& cm = m;
+
+    for (int id = -1; id < 10; ++id) {
+        PRINT_LINE("Id:", id);
+        PRINT_BOUND(m.find(lookup_key(m, id)), m.end());
+        PRINT_BOUND(cm.find(lookup_key(m, id)), cm.end());
+        PRINT_LINE("Count:", m.count(lookup_key(m, id)));
+        PRINT_BOUND(m.lower_bound(lookup_key(m, id)), m.end());
+        PRINT_BOUND(cm.upper_bound(lookup_key(m, id)), cm.end());
+        PRINT_EQ_RANGE(m.equal_range(lookup_key(m, id)), m.end());
+        PRINT_EQ_RANGE(cm.equal_range(lookup_key(m, id)), cm.end());
+    }
+
+    for (int id = 0; id < 70; id += 3) {
+        PRINT_LINE("Erased:", m.erase(lookup_key(m, id)));
+    }
+
+    PRINT_ALL(m);
+}
+
+MAIN(map_test_transparent_lookup)
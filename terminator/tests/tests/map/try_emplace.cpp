@@ -0,0 +1,87 @@
+#include "map_prelude.hpp"
+
+// try_emplace() is C++17; C++98 std::map gets the same effect from lower_bound + hinted insert
+template <typename Map>
+static typename Map::iterator map_try_emplace(Map& m, const typename Map::key_type& k,
+                                              const typename Map::mapped_type& obj, bool& inserted)
+{
+    typename Map::iterator it = m.lower_bound(k);
+
+    inserted = it == m.end() || m.key_comp()(k, it->first);
+    if (inserted) {
+        it = m.insert(it, typename Map::value_type(k, obj));
+    }
+    return it;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+static typename ft::map<Key, T, Compare, Alloc>::iterator
+map_try_emplace(ft::map<Key, T, Compare, Alloc>& m, const Key& k, const T& obj, bool& inserted)
+{
+    ft::pair<typename ft::map<Key, T, Compare, Alloc>::iterator, bool> ret = m.try_emplace(k, obj);
+
+    inserted = ret.second;
+    return ret.first;
+}
+
+template <typename Map>
+static typename Map::iterator map_try_emplace(Map& m, const typename Map::key_type& k,
+                                              bool& inserted)
+{
+    return map_try_emplace(m, k, typename Map::mapped_type(), inserted);
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc>
+static typename ft::map<Key, T, Compare, Alloc>::iterator
+map_try_emplace(ft::map<Key, T, Compare, Alloc>& m, const Key& k, bool& inserted)
+{
+    ft::pair<typename ft::map<Key, T, Compare, Alloc>::iterator, bool> ret = m.try_emplace(k);
+
+    inserted = ret.second;
+    return ret.first;
+}
+
+void map_test_try_emplace()
+{
+    SETUP_ARRAYS();
+
+    {
+        intmap m;
+        bool inserted;
+
+        for (std::size_t i = 0; i < intstr_size; ++i) {
+            intmap::iterator it =
+                map_try_emplace(m, intstr_arr[i].first, intstr_arr[i].second, inserted);
+
+            PRINT_PAIR_REF(*it);
+            PRINT_LINE("Inserted:", inserted);
+        }
+
+        PRINT_ALL(m);
+
+        for (std::size_t i = 0; i < intstr_size; i += 3) {
+            intmap::iterator it = map_try_emplace(m, intstr_arr[i].first, "overwritten?", inserted);
+
+            PRINT_PAIR_REF(*it);
+            PRINT_LINE("Inserted:", inserted);
+        }
+
+        PRINT_ALL(m);
+    }
+
+    {
+        strmap m(strstr_arr, strstr_arr + 10);
+        bool inserted;
+
+        for (std::size_t i = 5; i < strstr_size; ++i) {
+            strmap::iterator it = map_try_emplace(m, strstr_arr[i].first, inserted);
+
+            PRINT_PAIR_REF(*it);
+            PRINT_LINE("Inserted:", inserted);
+        }
+
+        PRINT_ALL(m);
+    }
+}
+
+MAIN(map_test_try_emplace)
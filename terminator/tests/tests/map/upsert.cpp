@@ -0,0 +1,77 @@
+#include "map_prelude.hpp"
+
+struct append_str {
+    void operator()(std::string& current, const std::string& obj) const
+    {
+        current += obj;
+    }
+};
+
+struct add_int {
+    void operator()(int& current, int obj) const
+    {
+        current += obj;
+    }
+};
+
+// upsert() is an ft extension; std::map gets the same effect from lower_bound + hinted insert
+template <typename Map, typename Combine>
+static typename Map::iterator map_upsert(Map& m, const typename Map::key_type& k,
+                                         const typename Map::mapped_type& obj, Combine combine,
+                                         bool& inserted)
+{
+    typename Map::iterator it = m.lower_bound(k);
+
+    inserted = it == m.end() || m.key_comp()(k, it->first);
+    if (inserted) {
+        it = m.insert(it, typename Map::value_type(k, obj));
+    } else {
+        combine(it->second, obj);
+    }
+    return it;
+}
+
+template <typename Key, typename T, typename Compare, typename Alloc, typename Combine>
+static typename ft::map<Key, T, Compare, Alloc>::iterator
+map_upsert(ft::map<Key, T, Compare, Alloc>& m, const Key& k, const T& obj, Combine combine,
+           bool& inserted)
+{
+    ft::pair<typename ft::map<Key, T, Compare, Alloc>::iterator, bool> ret =
+        m.upsert(k, obj, combine);
+
+    inserted = ret.second;
+    return ret.first;
+}
+
+void map_test_upsert()
+{
+    SETUP_ARRAYS();
+
+    {
+        strmap m;
+        bool inserted;
+
+        for (std::size_t i = 0; i < strstr_size; ++i) {
+            strmap::iterator it =
+                map_upsert(m, strstr_arr[i % 5].first, strstr_arr[i].second, append_str(), inserted);
+
+            PRINT_PAIR_REF(*it);
+            PRINT_LINE("Inserted:", inserted);
+        }
+
+        PRINT_ALL(m);
+    }
+
+    {
+        NAMESPACE::map<std::string, int> counts;
+        bool inserted;
+
+        for (std::size_t i = 0; i < intstr_size; ++i) {
+            map_upsert(counts, intstr_arr[i].second.substr(0, 1), 1, add_int(), inserted);
+        }
+
+        PRINT_ALL(counts);
+    }
+}
+
+MAIN(map_test_upsert)
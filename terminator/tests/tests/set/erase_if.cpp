@@ -0,0 +1,76 @@
+#include "set_prelude.hpp"
+
+namespace {
+
+struct is_odd {
+    bool operator()(int x) const
+    {
+        return x % 2 != 0;
+    }
+};
+
+struct starts_with_digit {
+    bool operator()(const std::string& s) const
+    {
+        return !s.empty() && s[0] >= '0' && s[0] <= '9';
+    }
+};
+
+// std::erase_if is C++20; the std side walks the set and erases as it goes
+template <typename Set, typename Predicate>
+typename Set::size_type set_erase_if(Set& s, Predicate pred)
+{
+    typename Set::size_type old_size = s.size();
+
+    for (typename Set::iterator it = s.begin(); it != s.end();) {
+        if (pred(*it)) {
+            s.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+    return old_size - s.size();
+}
+
+template <typename T, typename Compare, typename Alloc, typename Predicate>
+typename ft::set<T, Compare, Alloc>::size_type set_erase_if(ft::set<T, Compare, Alloc>& s,
+                                                            Predicate pred)
+{
+    return ft::erase_if(s, pred);
+}
+
+} // namespace
+
+void set_test_erase_if()
+{
+    SETUP_ARRAYS();
+
+    {
+        intset s(int_arr, int_arr + int_size);
+
+        PRINT_LINE("Erased:", set_erase_if(s, is_odd()));
+        PRINT_ALL(s);
+
+        PRINT_LINE("Erased:", set_erase_if(s, is_odd()));
+        PRINT_ALL(s);
+
+        s.insert(int_arr, int_arr + 10);
+
+        PRINT_LINE("Erased:", set_erase_if(s, is_odd()));
+        PRINT_ALL(s);
+    }
+
+    {
+        strset s;
+
+        PRINT_LINE("Erased:", set_erase_if(s, starts_with_digit()));
+        PRINT_ALL(s);
+
+        s.insert(str_arr, str_arr + str_size);
+
+        PRINT_LINE("Erased:", set_erase_if(s, starts_with_digit()));
+        PRINT_ALL(s);
+    }
+}
+
+MAIN(set_test_erase_if)
@@ -0,0 +1,76 @@
+#include "set_prelude.hpp"
+
+// reserve() is an ft extension; std::set has nothing to prepare
+template <typename Set>
+static void set_reserve(Set&, std::size_t)
+{
+}
+
+template <typename T, typename Compare, typename Alloc>
+static void set_reserve(ft::set<T, Compare, Alloc>& s, std::size_t n)
+{
+    s.reserve(n);
+}
+
+void set_test_reserve()
+{
+    SETUP_ARRAYS();
+
+    {
+        intset s;
+
+        set_reserve(s, int_size);
+
+        s.insert(int_arr, int_arr + int_size);
+
+        PRINT_ALL(s);
+
+        set_reserve(s, 10);
+
+        s.erase(s.begin(), s.end());
+
+        PRINT_ALL(s);
+
+        set_reserve(s, 100);
+
+        s.insert(int_arr, int_arr + 20);
+
+        PRINT_ALL(s);
+
+        s.clear();
+
+        PRINT_ALL(s);
+
+        s.insert(int_arr + 5, int_arr + 40);
+
+        PRINT_ALL(s);
+    }
+
+    {
+        strset s(str_arr, str_arr + str_size);
+
+        set_reserve(s, 64);
+
+        for (std::size_t i = 0; i < str_size; i += 2) {
+            s.erase(str_arr[i]);
+        }
+
+        PRINT_ALL(s);
+
+        strset small(str_arr, str_arr + 3);
+
+        s = small;
+
+        PRINT_ALL(s);
+
+        s = strset();
+
+        PRINT_ALL(s);
+
+        s = strset(str_arr, str_arr + str_size);
+
+        PRINT_ALL(s);
+    }
+}
+
+MAIN(set_test_reserve)
@@ -44,3 +44,6 @@ void set_test_comparisons_gt();
 void set_test_comparisons_ge();
 void set_test_random();
 void set_test_compare();
+void set_test_reserve();
+void set_test_transparent_lookup();
+void set_test_erase_if();
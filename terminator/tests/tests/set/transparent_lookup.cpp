@@ -0,0 +1,84 @@
+#include "set_prelude.hpp"
+
+namespace {
+
+// a value that can't be built implicitly from its id, so looking it up by id
+// only compiles through the heterogeneous overloads
+struct ticket {
+    explicit ticket(int id) : id(id)
+    {
+    }
+
+    int id;
+};
+
+std::ostream& operator<<(std::ostream& os, const ticket& t)
+{
+    return os << "#" << t.id;
+}
+
+struct ticket_less {
+    typedef void is_transparent;
+
+    bool operator()(const ticket& lhs, const ticket& rhs) const
+    {
+        return lhs.id < rhs.id;
+    }
+
+    bool operator()(const ticket& lhs, int rhs) const
+    {
+        return lhs.id < rhs;
+    }
+
+    bool operator()(int lhs, const ticket& rhs) const
+    {
+        return lhs < rhs.id;
+    }
+};
+
+// C++98 std::set has no heterogeneous lookup, so the std side builds the value
+template <typename Set>
+typename Set::key_type lookup_key(const Set&, int id)
+{
+    return typename Set::key_type(id);
+}
+
+template <typename T, typename Compare, typename Alloc>
+int lookup_key(const ft::set<T, Compare, Alloc>&, int id)
+{
+    return id;
+}
+
+} // namespace
+
+void set_test_transparent_lookup()
+{
+    typedef NAMESPACE::set<ticket, ticket_less, track_allocator<ticket> > ticketset;
+
+    ticketset s;
+
+    for (int i = 0; i < 64; i += 2) {
+        s.insert(ticket(i));
+    }
+
+    const ticketset& cs = s;
+
+    for (int id = -1; id < 10; ++id) {
+        PRINT_LINE("Id:", id);
+        PRINT_BOUND(s.find(lookup_key(s, id)), s.end());
+        PRINT_BOUND(cs.find(lookup_key(s, id)), cs.end());
+        PRINT_LINE("Count:", s.count(lookup_key(s, id)));
+        PRINT_BOUND(s.lower_bound(lookup_key(s, id)), s.end());
+        PRINT_BOUND(cs.upper_bound(lookup_key(s, id)), cs.end());
+        PRINT_EQ_RANGE(s.equal_range(lookup_key(s, id)), s.end());
+        PRINT_EQ_RANGE(cs.equal_range(lookup_key(s, id)), cs.end());
+    }
+
+    for (int id = 0; id < 70; id += 3) {
+        PRINT_LINE("Erased:", s.erase(lookup_key(s, id)));
+    }
+
+    PRINT_ALL(s);
+}
+
+MAIN(set_test_transparent_lookup)
@@ -0,0 +1,66 @@
+#include "vector_prelude.hpp"
+
+// emplace and emplace_back are C++11; in C++98 builds the same steps go
+// through insert and push_back with an already built value
+void vec_test_emplace()
+{
+    SETUP_ARRAYS();
+
+    {
+        // track_allocator only has the C++98 construct(p, val), so it can't see
+        // the in-place constructions and would report their destruction
+        NAMESPACE::vector<std::string> v;
+
+        for (std::size_t i = 0; i < 20; ++i) {
+#if __cplusplus >= 201103L
+            v.emplace_back(i + 1, s_char[i]);
+#else
+            v.push_back(std::string(i + 1, s_char[i]));
+#endif
+        }
+
+        CHECK_AND_PRINT_ALL(v);
+
+#if __cplusplus >= 201103L
+        NAMESPACE::vector<std::string>::iterator it = v.emplace(v.begin() + 5, 3, '#');
+        PRINT_LINE("It:", *it);
+        it = v.emplace(v.begin(), b_string[0]);
+        PRINT_LINE("It:", *it);
+        it = v.emplace(v.end(), 4, '!');
+        PRINT_LINE("It:", *it);
+        it = v.emplace(v.begin() + 2, v.back());
+        PRINT_LINE("It:", *it);
+#else
+        NAMESPACE::vector<std::string>::iterator it = v.insert(v.begin() + 5, std::string(3, '#'));
+        PRINT_LINE("It:", *it);
+        it = v.insert(v.begin(), b_string[0]);
+        PRINT_LINE("It:", *it);
+        it = v.insert(v.end(), std::string(4, '!'));
+        PRINT_LINE("It:", *it);
+        it = v.insert(v.begin() + 2, v.back());
+        PRINT_LINE("It:", *it);
+#endif
+
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        intvector v(b_int, b_int + 8);
+
+        v.reserve(v.size());
+
+        for (int i = 0; i < 10; ++i) {
+#if __cplusplus >= 201103L
+            v.emplace(v.begin() + i, v[v.size() - 1 - static_cast<std::size_t>(i)]);
+            v.emplace_back(v.front());
+#else
+            v.insert(v.begin() + i, v[v.size() - 1 - static_cast<std::size_t>(i)]);
+            v.push_back(v.front());
+#endif
+        }
+
+        CHECK_AND_PRINT_ALL(v);
+    }
+}
+
+MAIN(vec_test_emplace)
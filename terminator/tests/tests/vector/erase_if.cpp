@@ -0,0 +1,85 @@
+#include "vector_prelude.hpp"
+
+#include <algorithm>
+
+namespace {
+
+struct is_odd {
+    bool operator()(int x) const
+    {
+        return x % 2 != 0;
+    }
+};
+
+struct starts_with_digit {
+    bool operator()(const std::string& s) const
+    {
+        return !s.empty() && s[0] >= '0' && s[0] <= '9';
+    }
+};
+
+// std::erase_if is C++20; the std side uses the erase-remove idiom it replaces
+template <typename Vector, typename Predicate>
+typename Vector::size_type vec_erase_if(Vector& v, Predicate pred)
+{
+    typename Vector::size_type old_size = v.size();
+
+    v.erase(std::remove_if(v.begin(), v.end(), pred), v.end());
+    return old_size - v.size();
+}
+
+template <typename T, typename Alloc, typename Growth, typename Predicate>
+typename ft::vector<T, Alloc, Growth>::size_type vec_erase_if(ft::vector<T, Alloc, Growth>& v,
+                                                              Predicate pred)
+{
+    return ft::erase_if(v, pred);
+}
+
+} // namespace
+
+void vec_test_erase_if()
+{
+    SETUP_ARRAYS();
+
+    {
+        intvector v(b_int, b_int + b_size);
+
+        PRINT_LINE("Erased:", vec_erase_if(v, is_odd()));
+        CHECK_AND_PRINT_ALL(v);
+
+        PRINT_LINE("Erased:", vec_erase_if(v, is_odd()));
+        CHECK_AND_PRINT_ALL(v);
+
+        v.push_back(1);
+        v.insert(v.begin(), 3);
+
+        PRINT_LINE("Erased:", vec_erase_if(v, is_odd()));
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        intvector v;
+
+        PRINT_LINE("Erased:", vec_erase_if(v, is_odd()));
+        CHECK_AND_PRINT_ALL(v);
+
+        v.assign(7, 5);
+
+        PRINT_LINE("Erased:", vec_erase_if(v, is_odd()));
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        strvector v(b_string, b_string + b_size);
+
+        PRINT_LINE("Erased:", vec_erase_if(v, starts_with_digit()));
+        CHECK_AND_PRINT_ALL(v);
+
+        v.insert(v.end(), s_string, s_string + s_size);
+
+        PRINT_LINE("Erased:", vec_erase_if(v, starts_with_digit()));
+        CHECK_AND_PRINT_ALL(v);
+    }
+}
+
+MAIN(vec_test_erase_if)
@@ -0,0 +1,197 @@
+#include "vector_prelude.hpp"
+
+namespace {
+
+template <typename Vector>
+void grow_and_shrink(Vector& v, const int* arr, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i) {
+        v.push_back(arr[i]);
+    }
+    CHECK_AND_PRINT_ALL(v);
+
+    v.insert(v.begin() + 3, arr, arr + size);
+    v.erase(v.begin(), v.begin() + 10);
+    CHECK_AND_PRINT_ALL(v);
+
+    v.resize(v.size() * 3, 42);
+    v.resize(5);
+    CHECK_AND_PRINT_ALL(v);
+
+    v.clear();
+    CHECK_AND_PRINT_ALL(v);
+
+    v.insert(v.end(), 20, 7);
+    v.assign(arr, arr + size / 2);
+    CHECK_AND_PRINT_ALL(v);
+
+    Vector copy(v);
+    copy.push_back(-1);
+    v.swap(copy);
+    CHECK_AND_PRINT_ALL(v);
+    CHECK_AND_PRINT_ALL(copy);
+}
+
+// The capacities each policy goes through while 3000 ints are pushed back
+// one at a time. std::vector grows its own way, so the std side prints
+// these tables and the ft side what its vector really did.
+const std::size_t pushes = 3000;
+
+const std::size_t double_caps[] = {1,    2,    4,    8,    16,   32,  64,
+                                   128,  256,  512,  1024, 2048, 4096};
+const std::size_t half_caps[] = {1,   2,   3,   4,   6,    9,    13,   19,   28,   42,  63,
+                                 94,  141, 211, 316, 474,  711,  1066, 1599, 2398, 3597};
+// growth_half, in whole 4096-byte pages from 1066 ints on
+const std::size_t page_caps[] = {1,  2,   3,   4,   6,   9,   13,  19,   28,   42,
+                                 63, 94,  141, 211, 316, 474, 711, 2048, 3072};
+// growth_double, filled up to glibc's malloc chunk sizes
+const std::size_t size_class_caps[] = {6, 14, 30, 62, 126, 254, 510, 1022, 2046, 4094};
+
+template <typename Vector>
+std::size_t capacity_of(const Vector&, std::size_t expected)
+{
+    return expected;
+}
+
+template <typename T, typename Alloc, typename G>
+std::size_t capacity_of(const ft::vector<T, Alloc, G>& v, std::size_t)
+{
+    return v.capacity();
+}
+
+// prints the capacity each time a push_back changes it
+template <typename Vector>
+void push_and_print_capacity(Vector& v, const std::size_t* caps)
+{
+    std::size_t last = 0;
+    for (std::size_t i = 1; i <= pushes; ++i) {
+        v.push_back(static_cast<int>(i));
+        while (*caps < i) {
+            ++caps;
+        }
+        std::size_t cap = capacity_of(v, *caps);
+        if (cap != last) {
+            PRINT_LINE("Capacity:", cap);
+        }
+        last = cap;
+    }
+}
+
+// shrink_to_fit() is C++11; the std side uses the copy-and-swap idiom it replaces
+template <typename Vector>
+void vec_shrink_to_fit(Vector& v)
+{
+    Vector(v).swap(v);
+}
+
+template <typename T, typename Alloc, typename G>
+void vec_shrink_to_fit(ft::vector<T, Alloc, G>& v)
+{
+    v.shrink_to_fit();
+}
+
+void print_growth_stats(std::size_t reallocations, std::size_t bytes_copied,
+                        std::size_t peak_capacity)
+{
+    PRINT_LINE("Reallocations:", reallocations);
+    PRINT_LINE("Bytes copied:", bytes_copied);
+    PRINT_LINE("Peak capacity:", peak_capacity);
+}
+
+// After push_and_print_capacity() and a shrink: one reallocation per entry in
+// the table plus the shrink, each copying the elements it found.
+template <typename Vector>
+void print_growth_stats(const Vector& v, const std::size_t* caps, std::size_t count)
+{
+    std::size_t bytes = 0;
+    for (std::size_t i = 0; i + 1 < count; ++i) {
+        bytes += caps[i] * sizeof(int);
+    }
+    print_growth_stats(count + 1, bytes + v.size() * sizeof(int), caps[count - 1]);
+}
+
+template <typename T, typename Alloc, typename Base>
+void print_growth_stats(const ft::vector<T, Alloc, ft::growth_stats<Base> >& v,
+                        const std::size_t*, std::size_t)
+{
+    print_growth_stats(v.growth_policy().reallocations(), v.growth_policy().bytes_copied(),
+                       v.growth_policy().peak_capacity());
+}
+
+} // namespace
+
+void vec_test_growth_policy()
+{
+    SETUP_ARRAYS();
+
+    {
+        ft_or_std<ft::vector<int, track_allocator<int> >, intvector>::type v;
+        push_and_print_capacity(v, double_caps);
+    }
+
+    {
+        ft_or_std<ft::vector<int, track_allocator<int>, ft::growth_half>, intvector>::type v;
+        grow_and_shrink(v, b_int, b_size);
+    }
+    {
+        ft_or_std<ft::vector<int, track_allocator<int>, ft::growth_half>, intvector>::type v;
+        push_and_print_capacity(v, half_caps);
+    }
+
+    {
+        ft_or_std<ft::vector<int, track_allocator<int>, ft::growth_page_rounded<ft::growth_half> >,
+                  intvector>::type v;
+        grow_and_shrink(v, b_int, b_size);
+    }
+    {
+        ft_or_std<ft::vector<int, track_allocator<int>, ft::growth_page_rounded<ft::growth_half> >,
+                  intvector>::type v;
+        push_and_print_capacity(v, page_caps);
+    }
+
+    {
+        ft_or_std<ft::vector<int, track_allocator<int>, ft::growth_size_class<> >, intvector>::type
+            v;
+        grow_and_shrink(v, b_int, b_size);
+    }
+    {
+        ft_or_std<ft::vector<int, track_allocator<int>, ft::growth_size_class<> >, intvector>::type
+            v;
+        push_and_print_capacity(v, size_class_caps);
+    }
+
+    {
+        ft_or_std<ft::vector<int, track_allocator<int>, ft::growth_shrinking<> >, intvector>::type v;
+        grow_and_shrink(v, b_int, b_size);
+    }
+    {
+        // grows like growth_double; only clear() asks the policy to shrink,
+        // so erase keeps the buffer and clear() gives it all back
+        ft_or_std<ft::vector<int, track_allocator<int>, ft::growth_shrinking<> >, intvector>::type v;
+        push_and_print_capacity(v, double_caps);
+        v.erase(v.begin() + 500, v.end());
+        PRINT_LINE("Capacity:", capacity_of(v, 4096));
+        v.clear();
+        PRINT_LINE("Capacity:", capacity_of(v, 0));
+    }
+
+    {
+        ft_or_std<ft::vector<int, track_allocator<int>, ft::growth_stats<> >, intvector>::type v;
+        grow_and_shrink(v, b_int, b_size);
+    }
+    {
+        ft_or_std<ft::vector<int, track_allocator<int>, ft::growth_stats<> >, intvector>::type v;
+        push_and_print_capacity(v, double_caps);
+        vec_shrink_to_fit(v);
+        print_growth_stats(v, double_caps, sizeof(double_caps) / sizeof(*double_caps));
+    }
+    {
+        ft_or_std<ft::vector<int, track_allocator<int>, ft::growth_stats<ft::growth_half> >,
+                  intvector>::type v;
+        push_and_print_capacity(v, half_caps);
+        vec_shrink_to_fit(v);
+        print_growth_stats(v, half_caps, sizeof(half_caps) / sizeof(*half_caps));
+    }
+}
+
+MAIN(vec_test_growth_policy)
@@ -0,0 +1,144 @@
+#include "vector_prelude.hpp"
+#include "incremental_vector.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+typedef ft_or_std<ft::incremental_vector<int, track_allocator<int> >, intvector>::type
+    intincvector;
+typedef ft_or_std<ft::incremental_vector<int, track_allocator<int>, 1>, intvector>::type
+    intincvector1;
+typedef ft_or_std<ft::incremental_vector<std::string, track_allocator<std::string> >,
+                  strvector>::type strincvector;
+
+namespace {
+
+// the checks below are meant to run while elements are split between two
+// buffers; on the std side there is nothing to wait for
+template <typename Vector>
+bool is_migrating(const Vector&)
+{
+    return true;
+}
+
+template <typename T, typename Alloc, std::size_t Step>
+bool is_migrating(const ft::incremental_vector<T, Alloc, Step>& v)
+{
+    return v.is_migrating();
+}
+
+template <typename Vector>
+void push_until_migrating(Vector& v, const int* arr, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i) {
+        v.push_back(arr[i]);
+        if (i > 8 && is_migrating(v)) {
+            break;
+        }
+    }
+    PRINT_LINE("Migrating:", is_migrating(v));
+}
+
+} // namespace
+
+void vec_test_incremental_vector()
+{
+    SETUP_ARRAYS();
+
+    {
+        intincvector v;
+
+        push_until_migrating(v, b_int, b_size);
+        CHECK_AND_PRINT_ALL(v);
+
+        v[0] = -1;
+        v.back() = -2;
+        *(v.begin() + 3) = -3;
+        v.push_back(v[1]);
+        v.push_back(v.front());
+        CHECK_AND_PRINT_ALL(v);
+
+        intincvector copy(v);
+        CHECK_AND_PRINT_ALL(copy);
+
+        v.pop_back();
+        v.pop_back();
+        v.pop_back();
+        v.resize(v.size() + 40, 5);
+        CHECK_AND_PRINT_ALL(v);
+
+        std::sort(v.begin(), v.end());
+        CHECK_AND_PRINT_ALL(v);
+
+        v.reserve(500);
+        CHECK_AND_PRINT_ALL(v);
+
+        v.clear();
+        v.push_back(4);
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        intincvector a;
+        intincvector b(s_int, s_int + 3);
+
+        push_until_migrating(a, b_int, b_size);
+
+        a.swap(b);
+        CHECK_AND_PRINT_ALL(a);
+        CHECK_AND_PRINT_ALL(b);
+
+        b.push_back(b[b.size() - 1]);
+        NAMESPACE::swap(a, b);
+        CHECK_AND_PRINT_ALL(a);
+        CHECK_AND_PRINT_ALL(b);
+
+        b = a;
+        PRINT_LINE("==", a == b);
+        b.push_back(0);
+        PRINT_LINE("<", a < b);
+        PRINT_LINE("!=", a != b);
+    }
+
+    {
+        intincvector1 v;
+
+        for (std::size_t i = 0; i < b_size; ++i) {
+            v.push_back(b_int[i]);
+            if (i % 5 == 0) {
+                v.pop_back();
+            }
+        }
+        CHECK_AND_PRINT_ALL(v);
+
+        for (intincvector1::reverse_iterator it = v.rbegin(); it != v.rend(); ++it) {
+            PRINT_LINE("Rit:", *it);
+        }
+
+        try {
+            PRINT_LINE("At:", v.at(v.size()));
+        } catch (std::out_of_range& e) {
+            PRINT_LINE("Out of range exception", v.size());
+        }
+        CATCH_UNHANDLED_EX();
+    }
+
+    {
+        strincvector v;
+
+        for (std::size_t i = 0; i < b_size; ++i) {
+            v.push_back(b_string[i]);
+            if (i % 7 == 0) {
+                v.push_back(v[i / 2]);
+            }
+        }
+        CHECK_AND_PRINT_ALL(v);
+
+        const strincvector copy(v.begin() + 10, v.end());
+        CHECK_AND_PRINT_ALL(copy);
+
+        v = copy;
+        CHECK_AND_PRINT_ALL(v);
+    }
+}
+
+MAIN(vec_test_incremental_vector)
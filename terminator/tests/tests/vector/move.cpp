@@ -0,0 +1,59 @@
+#include "vector_prelude.hpp"
+
+// move construction and assignment are C++11; in C++98 builds the same steps
+// go through copies, which leave the same contents behind
+void vec_test_move()
+{
+    SETUP_ARRAYS();
+
+    {
+        strvector src(b_string, b_string + b_size);
+
+#if __cplusplus >= 201103L
+        strvector v(std::move(src));
+#else
+        strvector v(src);
+        src.clear();
+#endif
+
+        PRINT_SIZE(src);
+        CHECK_AND_PRINT_ALL(v);
+
+        strvector other(s_string, s_string + s_size);
+
+#if __cplusplus >= 201103L
+        v = std::move(other);
+#else
+        v = other;
+#endif
+
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        strvector v;
+
+        for (std::size_t i = 0; i < s_size; ++i) {
+            std::string s = s_string[i] + b_string[i];
+
+#if __cplusplus >= 201103L
+            v.push_back(std::move(s));
+            v.insert(v.begin() + static_cast<std::ptrdiff_t>(i / 2), std::string(s_string[i]));
+#else
+            v.push_back(s);
+            v.insert(v.begin() + static_cast<std::ptrdiff_t>(i / 2), s_string[i]);
+#endif
+        }
+
+        CHECK_AND_PRINT_ALL(v);
+
+        strvector big(b_string, b_string + b_size);
+
+        // a move from the temporary since C++11
+        big = strvector(s_string, s_string + 4);
+
+        CHECK_AND_PRINT_ALL(big);
+    }
+}
+
+MAIN(vec_test_move)
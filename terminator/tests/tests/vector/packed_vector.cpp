@@ -0,0 +1,169 @@
+#include "vector_prelude.hpp"
+#include "packed_vector.hpp"
+#include <stdexcept>
+
+typedef NAMESPACE::vector<unsigned int, track_allocator<unsigned int> > uintvector;
+typedef ft_or_std<ft::packed_vector<3, track_allocator<unsigned int> >, uintvector>::type
+    uintpackedvector;
+
+namespace {
+
+// get(), set() and unpack() are packed_vector's own; the std side goes through
+// operator[] and a copy
+template <typename Vector>
+unsigned int packed_get(const Vector& v, std::size_t i)
+{
+    return v[i];
+}
+
+template <std::size_t Bits, typename Alloc>
+unsigned int packed_get(const ft::packed_vector<Bits, Alloc>& v, std::size_t i)
+{
+    return v.get(i);
+}
+
+template <typename Vector>
+void packed_set(Vector& v, std::size_t i, unsigned int x)
+{
+    v[i] = x;
+}
+
+template <std::size_t Bits, typename Alloc>
+void packed_set(ft::packed_vector<Bits, Alloc>& v, std::size_t i, unsigned int x)
+{
+    v.set(i, x);
+}
+
+template <typename Vector>
+void packed_unpack(const Vector& v, std::size_t first, std::size_t n, unsigned int* out)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = v[first + i];
+    }
+}
+
+template <std::size_t Bits, typename Alloc>
+void packed_unpack(const ft::packed_vector<Bits, Alloc>& v, std::size_t first, std::size_t n,
+                   unsigned int* out)
+{
+    v.unpack(first, n, out);
+}
+
+template <typename Vector>
+void print_unpacked(const Vector& v, std::size_t first, std::size_t n)
+{
+    uintvector out(n, 0);
+
+    if (n > 0) {
+        packed_unpack(v, first, n, &out[0]);
+    }
+    PRINT_ALL(out);
+}
+
+} // namespace
+
+void vec_test_packed_vector()
+{
+    SETUP_ARRAYS();
+
+    {
+        uintpackedvector v;
+
+        for (unsigned int i = 0; i < 200; ++i) {
+            v.push_back(i % 8);
+        }
+        CHECK_AND_PRINT_ALL(v);
+
+        v.push_back(100);
+        v[3] = 1000;
+        packed_set(v, 150, 70000);
+        CHECK_AND_PRINT_ALL(v);
+
+        packed_set(v, 7, 4294967295u);
+        v[8] = v[7];
+        PRINT_LINE("Get:", packed_get(v, 7));
+        PRINT_LINE("Get:", packed_get(v, 8));
+        PRINT_LINE("Get:", packed_get(v, 150));
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        uintpackedvector v;
+
+        for (std::size_t i = 0; i < 300; ++i) {
+            v.push_back(static_cast<unsigned int>(b_int[i % b_size]) % (1u << (i % 20)));
+        }
+        CHECK_AND_PRINT_ALL(v);
+
+        print_unpacked(v, 0, v.size());
+        print_unpacked(v, 5, 250);
+        print_unpacked(v, 64, 128);
+        print_unpacked(v, 299, 1);
+        print_unpacked(v, 10, 0);
+
+        v.resize(130);
+        v.resize(140, 9);
+        v.pop_back();
+        CHECK_AND_PRINT_ALL(v);
+
+        v.reserve(1000);
+        v.clear();
+        v.push_back(1);
+        v.push_back(2);
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        uintpackedvector v(70, 5);
+
+        PRINT_LINE("Front:", v.front());
+        PRINT_LINE("Back:", v.back());
+        v.front() = 6;
+        v.back() = v.front();
+        PRINT_LINE("At:", v.at(69));
+
+        try {
+            PRINT_LINE("At:", v.at(70));
+        } catch (std::out_of_range& e) {
+            PRINT_LINE("Out of range exception", 70);
+        }
+        CATCH_UNHANDLED_EX();
+
+        uintpackedvector::iterator it = v.begin() + 10;
+        *it = 12;
+        it[1] = 13;
+        PRINT_LINE("It:", *it);
+        PRINT_LINE("Distance:", v.end() - it);
+
+        for (uintpackedvector::const_reverse_iterator rit = v.rbegin(); rit != v.rend(); ++rit) {
+            std::cout << *rit << " ";
+        }
+        std::cout << std::endl;
+    }
+
+    {
+        uintpackedvector a(s_int, s_int + s_size);
+        uintpackedvector b(5, 2);
+        uintpackedvector c(a);
+
+        CHECK_AND_PRINT_ALL(c);
+
+        c = b;
+        CHECK_AND_PRINT_ALL(c);
+
+        PRINT_LINE("==", b == c);
+        PRINT_LINE("!=", a != c);
+        PRINT_LINE("<", c < a);
+        PRINT_LINE(">=", c >= a);
+
+        a.swap(c);
+        CHECK_AND_PRINT_ALL(a);
+        CHECK_AND_PRINT_ALL(c);
+
+        NAMESPACE::swap(a, c);
+        CHECK_AND_PRINT_ALL(a);
+        CHECK_AND_PRINT_ALL(c);
+    }
+}
+
+MAIN(vec_test_packed_vector)
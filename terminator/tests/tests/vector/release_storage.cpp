@@ -0,0 +1,56 @@
+#include "vector_prelude.hpp"
+
+namespace {
+
+// release_storage() is an ft extension; the std side swaps with an empty vector
+template <typename Vector>
+void vec_release_storage(Vector& v)
+{
+    Vector().swap(v);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void vec_release_storage(ft::vector<T, Alloc, Growth>& v)
+{
+    v.release_storage();
+}
+
+} // namespace
+
+void vec_test_release_storage()
+{
+    SETUP_ARRAYS();
+
+    {
+        strvector v(b_string, b_string + b_size);
+
+        vec_release_storage(v);
+        PRINT_LINE("Capacity:", v.capacity());
+        CHECK_AND_PRINT_ALL(v);
+
+        v.insert(v.begin(), s_string, s_string + s_size);
+        v.push_back(b_string[0]);
+        CHECK_AND_PRINT_ALL(v);
+
+        vec_release_storage(v);
+        vec_release_storage(v);
+        PRINT_LINE("Capacity:", v.capacity());
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        intvector v;
+
+        vec_release_storage(v);
+        PRINT_LINE("Capacity:", v.capacity());
+
+        v.assign(b_int, b_int + b_size);
+        CHECK_AND_PRINT_ALL(v);
+
+        vec_release_storage(v);
+        PRINT_LINE("Capacity:", v.capacity());
+        PRINT_LINE("Empty:", v.empty());
+    }
+}
+
+MAIN(vec_test_release_storage)
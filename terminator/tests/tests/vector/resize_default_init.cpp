@@ -0,0 +1,94 @@
+#include "vector_prelude.hpp"
+
+namespace {
+
+// the std side value-initialises the new elements; every test overwrites them
+// before reading, so both sides print the same
+template <typename Vector>
+void vec_resize_default_init(Vector& v, std::size_t n)
+{
+    v.resize(n, typename Vector::value_type());
+}
+
+template <typename T, typename Alloc, typename Growth>
+void vec_resize_default_init(ft::vector<T, Alloc, Growth>& v, std::size_t n)
+{
+    v.resize_default_init(n);
+}
+
+template <typename Vector>
+void vec_resize_uninitialized(Vector& v, std::size_t n)
+{
+    v.resize(n, typename Vector::value_type());
+}
+
+template <typename T, typename Alloc, typename Growth>
+void vec_resize_uninitialized(ft::vector<T, Alloc, Growth>& v, std::size_t n)
+{
+    v.resize_uninitialized(n);
+}
+
+// what a read() into the new tail would do
+template <typename Vector, typename T>
+void fill_from(Vector& v, std::size_t from, const T* arr)
+{
+    for (std::size_t i = from; i < v.size(); ++i) {
+        v[i] = arr[i - from];
+    }
+}
+
+} // namespace
+
+void vec_test_resize_default_init()
+{
+    SETUP_ARRAYS();
+
+    {
+        intvector v(s_int, s_int + 10);
+
+        vec_resize_default_init(v, 40);
+        fill_from(v, 10, b_int);
+        CHECK_AND_PRINT_ALL(v);
+
+        vec_resize_default_init(v, 5);
+        CHECK_AND_PRINT_ALL(v);
+
+        vec_resize_default_init(v, 5);
+        vec_resize_default_init(v, 64);
+        fill_from(v, 5, b_int);
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        // with the default allocator the new ints are left as they are
+        NAMESPACE::vector<int> v;
+
+        vec_resize_default_init(v, 32);
+        fill_from(v, 0, s_int);
+        CHECK_AND_PRINT_ALL(v);
+
+        vec_resize_uninitialized(v, 16);
+        vec_resize_uninitialized(v, 64);
+        fill_from(v, 16, b_int);
+        CHECK_AND_PRINT_ALL(v);
+
+        NAMESPACE::vector<char> c;
+
+        vec_resize_uninitialized(c, 20);
+        fill_from(c, 0, s_char);
+        CHECK_AND_PRINT_ALL(c);
+    }
+
+    {
+        strvector v(s_string, s_string + 4);
+
+        vec_resize_default_init(v, 10);
+        CHECK_AND_PRINT_ALL(v);
+
+        fill_from(v, 4, b_string);
+        vec_resize_default_init(v, 7);
+        CHECK_AND_PRINT_ALL(v);
+    }
+}
+
+MAIN(vec_test_resize_default_init)
@@ -0,0 +1,139 @@
+#include "vector_prelude.hpp"
+#include "segmented_vector.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+typedef ft_or_std<ft::segmented_vector<int, track_allocator<int>, 4>, intvector>::type
+    intsegvector;
+typedef ft_or_std<ft::segmented_vector<std::string, track_allocator<std::string>, 4>,
+                  strvector>::type strsegvector;
+
+namespace {
+
+// ft::segmented_vector never moves its elements; std::vector only keeps them
+// in place when it doesn't have to grow
+template <typename Vector>
+void keep_in_place(Vector& v, std::size_t n)
+{
+    v.reserve(n);
+}
+
+template <typename T, typename Alloc, std::size_t Chunk>
+void keep_in_place(ft::segmented_vector<T, Alloc, Chunk>&, std::size_t)
+{
+}
+
+} // namespace
+
+void vec_test_segmented_vector()
+{
+    SETUP_ARRAYS();
+
+    {
+        intsegvector v;
+
+        for (std::size_t i = 0; i < 13; ++i) {
+            v.push_back(b_int[i]);
+        }
+        CHECK_AND_PRINT_ALL(v);
+
+        v.pop_back();
+        v.pop_back();
+        v.resize(20, 3);
+        CHECK_AND_PRINT_ALL(v);
+
+        v.resize(6);
+        v.reserve(50);
+        CHECK_AND_PRINT_ALL(v);
+
+        intsegvector::iterator it = v.begin() + 2;
+        PRINT_LINE("It:", *it);
+        PRINT_LINE("It[3]:", it[3]);
+        PRINT_LINE("Distance:", v.end() - it);
+        PRINT_LINE("It < end:", it < v.end());
+        it += 3;
+        PRINT_LINE("It:", *it);
+        it -= 4;
+        PRINT_LINE("It:", *it);
+
+        v = intsegvector(b_int, b_int + b_size);
+        std::sort(v.begin(), v.end());
+        CHECK_AND_PRINT_ALL(v);
+
+        for (std::ptrdiff_t i = 0; i < v.rend() - v.rbegin(); i += 9) {
+            PRINT_LINE("Rit:", v.rbegin()[i]);
+        }
+
+        v.clear();
+        v.push_back(1);
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        intsegvector v(5, 8);
+
+        keep_in_place(v, 200);
+
+        const int* first = &v.front();
+        int& fifth = v[4];
+
+        for (int i = 0; i < 150; ++i) {
+            v.push_back(i);
+        }
+        PRINT_LINE("Front kept:", first == &v.front());
+        PRINT_LINE("Fifth kept:", &fifth == &v[4]);
+        CHECK_AND_PRINT_ALL(v);
+
+        v.push_back(v.back());
+        v.push_back(v[0]);
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        const intsegvector v(s_int, s_int + 9);
+
+        PRINT_LINE("Front:", v.front());
+        PRINT_LINE("Back:", v.back());
+        PRINT_LINE("[]:", v[5]);
+
+        try {
+            PRINT_LINE("At:", v.at(9));
+        } catch (std::out_of_range& e) {
+            PRINT_LINE("Out of range exception", 9);
+        }
+        CATCH_UNHANDLED_EX();
+
+        for (intsegvector::const_iterator it = v.begin(); it != v.end(); ++it) {
+            PRINT_LINE("Cit:", *it);
+        }
+    }
+
+    {
+        strsegvector v(s_string, s_string + s_size);
+        strsegvector small(b_string, b_string + 3);
+        strsegvector copy(v);
+
+        CHECK_AND_PRINT_ALL(copy);
+
+        copy = small;
+        CHECK_AND_PRINT_ALL(copy);
+
+        small = v;
+        CHECK_AND_PRINT_ALL(small);
+
+        PRINT_LINE("==", small == v);
+        PRINT_LINE("!=", copy != v);
+        PRINT_LINE("<", copy < v);
+        PRINT_LINE(">", copy > v);
+
+        copy.swap(v);
+        CHECK_AND_PRINT_ALL(copy);
+        CHECK_AND_PRINT_ALL(v);
+
+        NAMESPACE::swap(copy, v);
+        CHECK_AND_PRINT_ALL(copy);
+        CHECK_AND_PRINT_ALL(v);
+    }
+}
+
+MAIN(vec_test_segmented_vector)
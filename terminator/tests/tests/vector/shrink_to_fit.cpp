@@ -0,0 +1,68 @@
+#include "vector_prelude.hpp"
+
+namespace {
+
+// shrink_to_fit() is C++11; the std side uses the copy-and-swap idiom it replaces
+template <typename Vector>
+void vec_shrink_to_fit(Vector& v)
+{
+    Vector(v).swap(v);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void vec_shrink_to_fit(ft::vector<T, Alloc, Growth>& v)
+{
+    v.shrink_to_fit();
+}
+
+} // namespace
+
+#define CHECK_FIT(vec)                                                                             \
+    {                                                                                              \
+        PRINT_LINE("Capacity fits:", vec.capacity() == vec.size());                                \
+    }
+
+void vec_test_shrink_to_fit()
+{
+    SETUP_ARRAYS();
+
+    {
+        intvector v(b_int, b_int + b_size);
+
+        v.reserve(500);
+        vec_shrink_to_fit(v);
+        CHECK_FIT(v);
+        CHECK_AND_PRINT_ALL(v);
+
+        v.erase(v.begin() + 5, v.end() - 5);
+        vec_shrink_to_fit(v);
+        CHECK_FIT(v);
+        CHECK_AND_PRINT_ALL(v);
+
+        vec_shrink_to_fit(v);
+        CHECK_FIT(v);
+
+        v.push_back(42);
+        v.insert(v.begin(), s_int, s_int + s_size);
+        CHECK_AND_PRINT_ALL(v);
+
+        v.clear();
+        vec_shrink_to_fit(v);
+        CHECK_FIT(v);
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        strvector v(b_string, b_string + b_size);
+
+        v.resize(7);
+        vec_shrink_to_fit(v);
+        CHECK_FIT(v);
+        CHECK_AND_PRINT_ALL(v);
+
+        v.insert(v.end(), s_string, s_string + s_size);
+        CHECK_AND_PRINT_ALL(v);
+    }
+}
+
+MAIN(vec_test_shrink_to_fit)
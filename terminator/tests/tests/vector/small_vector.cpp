@@ -0,0 +1,116 @@
+#include "vector_prelude.hpp"
+#include "small_vector.hpp"
+#include <stdexcept>
+
+typedef ft_or_std<ft::small_vector<int, 8, track_allocator<int> >, intvector>::type intsmallvector;
+typedef ft_or_std<ft::small_vector<std::string, 4, track_allocator<std::string> >, strvector>::type
+    strsmallvector;
+
+void vec_test_small_vector()
+{
+    SETUP_ARRAYS();
+
+    {
+        intsmallvector v;
+
+        for (std::size_t i = 0; i < 8; ++i) {
+            v.push_back(s_int[i]);
+        }
+        CHECK_AND_PRINT_ALL(v);
+
+        v.push_back(-1);
+        v.insert(v.begin() + 2, b_int, b_int + 10);
+        CHECK_AND_PRINT_ALL(v);
+
+        v.erase(v.begin() + 1, v.end() - 3);
+        v.insert(v.end() - 1, 3, 42);
+        CHECK_AND_PRINT_ALL(v);
+
+        v.resize(20, 7);
+        v.resize(2);
+        v.pop_back();
+        CHECK_AND_PRINT_ALL(v);
+
+        v.assign(b_int, b_int + b_size);
+        v.erase(v.begin());
+        CHECK_AND_PRINT_ALL(v);
+
+        v.clear();
+        v.assign(5, 9);
+        CHECK_AND_PRINT_ALL(v);
+    }
+
+    {
+        intsmallvector small(s_int, s_int + 5);
+        intsmallvector big(b_int, b_int + 20);
+        intsmallvector copy(small);
+
+        CHECK_AND_PRINT_ALL(copy);
+
+        copy = big;
+        CHECK_AND_PRINT_ALL(copy);
+
+        copy = small;
+        CHECK_AND_PRINT_ALL(copy);
+
+        PRINT_LINE("==", small == copy);
+        PRINT_LINE("!=", small != big);
+        PRINT_LINE("<", small < big);
+        PRINT_LINE(">=", small >= big);
+
+        small.swap(big);
+        CHECK_AND_PRINT_ALL(small);
+        CHECK_AND_PRINT_ALL(big);
+
+        NAMESPACE::swap(small, copy);
+        CHECK_AND_PRINT_ALL(small);
+        CHECK_AND_PRINT_ALL(copy);
+
+        intsmallvector other(b_int + 30, b_int + 60);
+        copy.swap(other);
+        CHECK_AND_PRINT_ALL(copy);
+        CHECK_AND_PRINT_ALL(other);
+
+        for (intsmallvector::reverse_iterator it = copy.rbegin(); it != copy.rend(); ++it) {
+            PRINT_LINE("Rit:", *it);
+        }
+    }
+
+    {
+        const intsmallvector v(s_int, s_int + 4);
+
+        PRINT_LINE("Front:", v.front());
+        PRINT_LINE("Back:", v.back());
+        PRINT_LINE("[]:", v[2]);
+
+        try {
+            PRINT_LINE("At:", v.at(4));
+        } catch (std::out_of_range& e) {
+            PRINT_LINE("Out of range exception", 4);
+        }
+        CATCH_UNHANDLED_EX();
+    }
+
+    {
+        strsmallvector v(s_string, s_string + 3);
+
+        v.insert(v.begin() + 1, v.back());
+        CHECK_AND_PRINT_ALL(v);
+
+        v.insert(v.begin(), b_string, b_string + 10);
+        v.push_back(v.front());
+        CHECK_AND_PRINT_ALL(v);
+
+        v.erase(v.begin() + 2, v.end());
+        v.reserve(64);
+        CHECK_AND_PRINT_ALL(v);
+
+        strsmallvector copy(v.begin(), v.end());
+        copy.insert(copy.end(), 6, "fill");
+        v.swap(copy);
+        CHECK_AND_PRINT_ALL(v);
+        CHECK_AND_PRINT_ALL(copy);
+    }
+}
+
+MAIN(vec_test_small_vector)
@@ -0,0 +1,209 @@
+#include "vector_prelude.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+typedef NAMESPACE::vector<bool, track_allocator<bool> > boolvector;
+
+namespace {
+
+// count, find_first/find_next and the bitwise operators are ft extensions;
+// the std side does the same one flag at a time
+template <typename Vector>
+std::size_t bool_count(const Vector& v)
+{
+    return static_cast<std::size_t>(std::count(v.begin(), v.end(), true));
+}
+
+template <typename Alloc, typename Growth>
+std::size_t bool_count(const ft::vector<bool, Alloc, Growth>& v)
+{
+    return v.count();
+}
+
+template <typename Vector>
+void print_set_flags(const Vector& v)
+{
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        if (v[i]) {
+            std::cout << i << " ";
+        }
+    }
+    std::cout << std::endl;
+}
+
+template <typename Alloc, typename Growth>
+void print_set_flags(const ft::vector<bool, Alloc, Growth>& v)
+{
+    for (std::size_t i = v.find_first(); i < v.size(); i = v.find_next(i)) {
+        std::cout << i << " ";
+    }
+    std::cout << std::endl;
+}
+
+enum bit_op { AND, OR, XOR };
+
+// v keeps its size; past x.size() x's bits count as false
+template <typename Vector>
+void bitwise(Vector& v, const Vector& x, bit_op op)
+{
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        bool a = v[i];
+        bool b = i < x.size() && x[i];
+
+        v[i] = op == AND ? (a && b) : op == OR ? (a || b) : (a != b);
+    }
+}
+
+template <typename Alloc, typename Growth>
+void bitwise(ft::vector<bool, Alloc, Growth>& v, const ft::vector<bool, Alloc, Growth>& x,
+             bit_op op)
+{
+    if (op == AND) {
+        v &= x;
+    } else if (op == OR) {
+        v |= x;
+    } else {
+        v ^= x;
+    }
+}
+
+} // namespace
+
+void vec_test_vector_bool()
+{
+    SETUP_ARRAYS();
+
+    {
+        boolvector v;
+
+        for (std::size_t i = 0; i < b_size; ++i) {
+            v.push_back(b_int[i] % 3 == 0);
+        }
+        for (std::size_t i = 0; i < b_size; ++i) {
+            v.push_back(s_int[i % s_size] % 2 == 0);
+        }
+        CHECK_AND_PRINT_ALL(v);
+        PRINT_LINE("Count:", bool_count(v));
+        print_set_flags(v);
+
+        v.insert(v.begin() + 3, true);
+        v.insert(v.begin() + 60, 10, true);
+        v.insert(v.end() - 1, v.begin(), v.begin() + 70);
+        CHECK_AND_PRINT_ALL(v);
+
+        v.erase(v.begin() + 1);
+        v.erase(v.begin() + 5, v.begin() + 100);
+        v.pop_back();
+        CHECK_AND_PRINT_ALL(v);
+        PRINT_LINE("Count:", bool_count(v));
+
+        v.resize(300, true);
+        v.resize(129);
+        v.resize(131, false);
+        CHECK_AND_PRINT_ALL(v);
+
+        v.flip();
+        CHECK_AND_PRINT_ALL(v);
+        print_set_flags(v);
+    }
+
+    {
+        boolvector v(70, false);
+
+        v[0] = true;
+        v[63] = v[0];
+        v[64] = !v[1];
+        v.back().flip();
+        v.front().flip();
+        boolvector::swap(v[1], v[63]);
+        PRINT_LINE("Front:", v.front());
+        PRINT_LINE("Back:", v.back());
+        PRINT_LINE("At:", v.at(64));
+        CHECK_AND_PRINT_ALL(v);
+
+        try {
+            PRINT_LINE("At:", v.at(70));
+        } catch (std::out_of_range& e) {
+            PRINT_LINE("Out of range exception", 70);
+        }
+        CATCH_UNHANDLED_EX();
+
+        boolvector::iterator it = v.begin() + 62;
+        *it = true;
+        it[2] = false;
+        PRINT_LINE("Distance:", v.end() - it);
+        PRINT_LINE("It:", *it);
+        PRINT_LINE("It + 2:", *(it + 2));
+        PRINT_LINE("It - 62:", *(it - 62));
+
+        for (boolvector::const_reverse_iterator rit = v.rbegin(); rit != v.rend(); ++rit) {
+            std::cout << *rit;
+        }
+        std::cout << std::endl;
+    }
+
+    {
+        boolvector a;
+        boolvector b;
+
+        for (std::size_t i = 0; i < 100; ++i) {
+            a.push_back(b_int[i % b_size] % 2 == 0);
+            b.push_back(b_int[(i * 7) % b_size] % 5 < 2);
+        }
+
+        boolvector c(a);
+        bitwise(c, b, AND);
+        CHECK_AND_PRINT_ALL(c);
+        c = a;
+        bitwise(c, b, OR);
+        CHECK_AND_PRINT_ALL(c);
+        c = a;
+        bitwise(c, b, XOR);
+        CHECK_AND_PRINT_ALL(c);
+
+        PRINT_LINE("==", a == c);
+        PRINT_LINE("<", a < b);
+        PRINT_LINE(">=", b >= c);
+
+        a.swap(b);
+        CHECK_AND_PRINT_ALL(a);
+        NAMESPACE::swap(a, c);
+        CHECK_AND_PRINT_ALL(a);
+
+        c.assign(5, true);
+        c.assign(b.begin() + 10, b.begin() + 80);
+        CHECK_AND_PRINT_ALL(c);
+
+        c.clear();
+        PRINT_LINE("Count:", bool_count(c));
+        print_set_flags(c);
+    }
+
+    {
+        boolvector longer;
+        boolvector shorter;
+
+        for (std::size_t i = 0; i < 150; ++i) {
+            longer.push_back(b_int[i % b_size] % 3 != 0);
+        }
+        for (std::size_t i = 0; i < 37; ++i) {
+            shorter.push_back(b_int[(i * 5) % b_size] % 2 == 0);
+        }
+
+        for (int op = AND; op <= XOR; ++op) {
+            boolvector c(longer);
+            bitwise(c, shorter, static_cast<bit_op>(op));
+            CHECK_AND_PRINT_ALL(c);
+            PRINT_LINE("Count:", bool_count(c));
+
+            // the bits of longer past 37 must not leak into the tail
+            c = shorter;
+            bitwise(c, longer, static_cast<bit_op>(op));
+            CHECK_AND_PRINT_ALL(c);
+            PRINT_LINE("Count:", bool_count(c));
+            print_set_flags(c);
+        }
+    }
+}
+
+MAIN(vec_test_vector_bool)
@@ -116,6 +116,24 @@ typedef NAMESPACE::vector<long, track_allocator<long> > longvector;
 typedef NAMESPACE::vector<double, track_allocator<double> > doublevector;
 typedef NAMESPACE::vector<char, track_allocator<char> > charvector;
 
+// What only ft has (growth policies, the other vector-like containers) is
+// checked against the std::vector holding the same elements:
+// ft_or_std<FtType, StdType>::type is FtType in the ft build, StdType in std's.
+template <bool IsFt, typename FtType, typename StdType>
+struct pick_type {
+    typedef FtType type;
+};
+
+template <typename FtType, typename StdType>
+struct pick_type<false, FtType, StdType> {
+    typedef StdType type;
+};
+
+template <typename FtType, typename StdType>
+struct ft_or_std
+    : pick_type<is_same<NAMESPACE::vector<int>, ft::vector<int> >::value, FtType, StdType> {
+};
+
 template <typename T>
 T times2(const T& x)
 {
@@ -52,3 +52,15 @@ void vec_test_reserve();
 void vec_test_resize();
 void vec_test_swap();
 void vec_test_random();
+void vec_test_erase_if();
+void vec_test_emplace();
+void vec_test_move();
+void vec_test_growth_policy();
+void vec_test_shrink_to_fit();
+void vec_test_release_storage();
+void vec_test_small_vector();
+void vec_test_segmented_vector();
+void vec_test_incremental_vector();
+void vec_test_resize_default_init();
+void vec_test_vector_bool();
+void vec_test_packed_vector();
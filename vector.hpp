@@ -4,21 +4,29 @@
 # include "Iterator.hpp"
 # include "equal.hpp"
 # include "iterator_traits.hpp"
+# include "GrowthPolicy.hpp"
+# include "AllocatorTraits.hpp"
+# include "Debug.hpp"
+# include "VectorBase.hpp"
 
 # include <memory>
 # include <algorithm>
 # include <stdexcept>
 # include <iostream>
+# include <cstring>
+# include <utility>
+# include <iterator>
 
     namespace   ft {
-    
-    template<typename T, typename A = std::allocator<T> >
+
+    template<typename T, typename A = std::allocator<T>, typename G = ft::growth_double>
 // class VECTOR ****************************************************************
-    class vector {
-        
+    class vector : private ft::vector_base<T, A, G> {
+
         public :
             typedef	T														value_type;
 			typedef A   													allocator_type;
+			typedef G														growth_policy_type;
 
 			typedef typename allocator_type::reference						reference;
 			typedef typename allocator_type::const_reference				const_reference;
@@ -31,416 +39,179 @@
 			typedef ft::reverse_iterator<const_iterator>					const_reverse_iterator;
 			typedef typename iterator_traits<iterator>::difference_type		difference_type;
 			typedef size_t													size_type;
-        
+
         private:
-            
-            allocator_type	 _alloc; 
-            size_type _capacity;
-            value_type *arr;
-            size_type _size;
-           
-            
-            size_type increasingCapacity(size_type n) {
-                if (n + _size <= _capacity)
-                    return _capacity;
-                else if (n + _size > _capacity * 2)
-                    return (n + _size);
-                else 
-                    return (_capacity * 2);
-            }
-           
-            void deallocateArray()
-            {
-                if (_capacity == 0)
-                    return ;
-                while (_size > 0)
-                    _alloc.destroy(_alloc.address(arr[--_size]));
-                if (_capacity > 0)
-                    _alloc.deallocate(arr, _capacity);
-                _capacity = 0;
-            }
+
+            // the buffer and every algorithm on it; vector adds the
+            // constructors and what only it offers
+            typedef ft::vector_base<T, A, G>                                base_type;
+            using base_type::_alloc;
+            using base_type::_capacity;
+            using base_type::arr;
+            using base_type::_size;
+            using base_type::uninitializedFill;
+            using base_type::increasingCapacity;
+            using base_type::dropElements;
+            using base_type::truncate;
+            using base_type::reallocateTo;
+            using base_type::debugInvalidateFrom;
+
+            typedef typename base_type::trivial_default_init			trivial_default_init;
 
         public:
 // CONSTRUCTORS-------------------------------------------------------------------
-            
-            explicit	vector( const allocator_type& alloc = allocator_type() )	:	
-                        _alloc(alloc), _capacity(0), arr(NULL),	_size(0) {};
 
+            explicit	vector( const allocator_type& alloc = allocator_type() )	:	base_type(alloc) {};
+
+			// a throw leaves the buffer to ~vector_base
 			explicit	vector( size_type n, const value_type& val = value_type(),
-							const allocator_type& alloc = allocator_type() )    : _alloc(alloc), _capacity(0), arr(NULL), _size(0)		
-            {	
-                
+							const allocator_type& alloc = allocator_type() )    : base_type(alloc)
+            {
                 if (n == 0)
                     return;
                 reserve(n);
-                while (_size < n) 
-                    push_back(val);
+                uninitializedFill(arr, n, val);
+                _size = n;
             };
 
 			template <class InputIterator>
-			vector( InputIterator first, InputIterator last, 
-                const allocator_type& alloc = allocator_type(), 
-                typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)	:  
-                _alloc(alloc), _capacity(0), arr(NULL), _size(0) 	
+			vector( InputIterator first, InputIterator last,
+                const allocator_type& alloc = allocator_type(),
+                typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)	:  base_type(alloc)
             {	insert(begin(), first, last);	};
 
-			vector( const vector& x )								
-            { _size = 0; _capacity = 0; *this = x;   };
+			vector( const vector& x )	:	base_type(x._alloc)
+            {   this->assignFrom(x);   };
+
+# if __cplusplus >= 201103L
+            vector( vector&& x ) noexcept : base_type(std::move(x._alloc), x.growth_policy())
+            {   this->moveConstruct(x);    }
+
+            vector&					operator = (vector&& x)
+            {
+                if (this != &x)
+                    this->moveAssign(x);
+                return *this;
+            }
+# endif
 
+            // Reuses the buffer when it is big enough: the common prefix is
+            // assigned over, only the size difference is constructed or
+            // destroyed. Otherwise allocates exactly x.size().
 			vector&					operator = (const vector& x)
 			{
-                if (*this == x)
-                    return *this;
-                deallocateArray();
-                _alloc = x.get_allocator();
-                _capacity = x.capacity();
-                arr = _alloc.allocate(_capacity);
-                assign(x.begin(), x.end());
+                if (this != &x)
+                    this->assignFrom(x);
 				return *this;
 			}
-// DESTRUCTOR-------------------------------------------------------------------
-            ~vector()   { deallocateArray(); } //   std::cout << "Delete vector.\n"; }
 
 // Element access:--------------------------------------------------------------
-        T &operator[](size_type index){
-            if (index > _size)
-                throw std::out_of_range("out out_of_range");
-            return (arr[index]);
-        }
-
-        const T &operator[] (size_type index) const {
-            if (index > _size)
-                throw std::out_of_range("out out_of_range");
-            return (arr[index]);
-        }
+        using base_type::operator[];
+        using base_type::at;
+        using base_type::front;
+        using base_type::back;
+        using base_type::data;
 
-        T &at (size_type n)
-        {
-            if (n >= _size)
-                throw std::out_of_range("_M_range_check");
-            return *(arr + n);
-        }
-        
-        const T &at (size_type n) const
-        {
-            if (n >= _size)
-                throw std::out_of_range("_M_range_check");
-            return *(arr + n);
-        }
-        
-        T& front()  {
-            if (empty())
-                throw std::out_of_range("Vector:: is empty stack");
-            return *arr;
-        }
-        
-        const T& front() const  { 
-            if (empty())
-                throw std::out_of_range("Vector:: is empty stack");
-            return *arr;
-        }
-        
-        T& back()  {
-            if (empty())
-                throw std::out_of_range("Vector:: is empty stack");
-            return *(arr + _size - 1);
-        }
-        
-        const T& back() const   {
-            if (empty())
-                throw std::out_of_range("Vector:: is empty stack");
-            return *(arr + _size - 1);
-        }
-        
-        T* data() { return arr; }
-        
-        T* data() const { return arr; }
-        
 //==============================================================================
 
 // Capacity:--------------------------------------------------------------------
-        
-        size_type size() const { return (_size); }
-        
-        size_type max_size() const { return _alloc.max_size(); }
-        
-        void resize (size_type n, const value_type& val = value_type())
+        using base_type::size;
+        using base_type::max_size;
+        using base_type::resize;
+
+        // Like resize(n), but the new elements are default-initialised:
+        // trivially constructible ones keep whatever the memory held, for a
+        // caller about to overwrite them all (a read(), a decoder).
+        void resize_default_init (size_type n)
         {
+            if (n <= _size)
+            {
+                truncate(n);
+                return;
+            }
+            debugInvalidateFrom(arr + _size);
             if (n > _capacity)
                 reserve(increasingCapacity(n - _size));
-            while (n < _size)	
-                pop_back();
-			while (n > _size)	
-			    push_back(val);
+            if (!trivial_default_init::value)
+                uninitializedFill(arr + _size, n - _size, value_type());
+            _size = n;
         }
 
-        size_type capacity() const { return (_capacity); }
-        
-        bool empty() const  { return (_size == 0); }
-
-        void reserve( size_type new_cap ) {
-                if (new_cap <= _capacity)
-                    return;
-                if (new_cap > max_size())
-                    throw std::length_error("_Maximum_size_out");
-                size_type last_cap = _capacity;
-                _capacity = new_cap;
-                T* tmp = _alloc.allocate(_capacity);
-                size_type s = 0;
-                while (s < _size){
-                    _alloc.construct( tmp + s, arr[s]);
-                    s++;
-                }
-                size_type i = 0;
-                while (i < _size) _alloc.destroy(arr + i++);   
-                if (last_cap > 0)
-                    _alloc.deallocate(arr, last_cap);
-                arr = tmp;
-            }
-            
-        void shrink_to_fit() { _capacity = _size; }
-        
-//==============================================================================
-
-// Modifiers:-------------------------------------------------------------------
-        template <class InputIterator>
-		void		assign( InputIterator first, InputIterator last,
-							typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0 )
-        {
-            clear();
-            reserve(ft::distance(first, last));
-            for (; first != last; ++first)
-                    push_back(*first);
-        }
-        
-        void assign (size_type n, const value_type& val)
+        // resize_default_init() that never constructs anything: only compiles
+        // for trivially default constructible T
+        void resize_uninitialized (size_type n)
         {
-            clear();
-            reserve(n);
-            insert(begin(), n, val);
-        }
-        
-        void push_back(const value_type& elem) {
-            if (_size >= _capacity)
-                reserve(increasingCapacity(1));
-            _alloc.construct(arr + _size, elem);
-            _size++;
-        }
-        
-        void pop_back(void) {
-            if (_size > 0) {
-                _alloc.destroy(_alloc.address(arr [_size - 1]));
-                _size--;
-            }
-        }
-        
-        iterator insert (iterator position, const T& val) { 
-            iterator it = begin();
-            size_t i = 0;
-            for (; i < _size ; i++)
-                if (it++ == position)
-                    break;
-            insert(position, 1, val);
-            return (iterator(arr + i));
+            typedef char needs_trivially_default_constructible_type[trivial_default_init::value ? 1 : -1];
+            (void)sizeof(needs_trivially_default_constructible_type);
+            resize_default_init(n);
         }
-        
-        void insert (iterator position, size_type n, const T& val)
-        {
-            iterator pos = begin();
-            size_type new_cap = _capacity;
-            size_type new_size = _size + n;
-            
-            if (new_size > _capacity)
-                new_cap = increasingCapacity(n);
-            if (new_cap == 0 || n == 0)
-                return;
-            if (new_cap > max_size())
-                throw std::length_error("vector:_Maximum_size_out");
-            // else if (position < begin() && position > end())
-            //     throw std::logic_error("vector:insert error");
-            if (position == end())
-            {
-                while (_size < new_size)
-                    push_back(val);
-                _capacity = new_cap;
-                return;
 
-            }
-            value_type *tmp = _alloc.allocate(new_cap);
-            size_type i = 0;
-            while(i < new_size){
-                if (pos == position) {
-                    while (n > 0) {
-                        _alloc.construct(_alloc.address(tmp[i++]), val);
-                        n--;
-                    }
-                }
-                if (pos != end())
-                    _alloc.construct(_alloc.address(tmp[i++]), (*pos));
-                ++pos;
-            }
-            deallocateArray();
-            arr = tmp;
-            _capacity = new_cap;
-            _size = new_size;
-        }
-        
-           
-        template <class InputIterator>
-			void	insert( iterator position, InputIterator first, InputIterator last,
-							typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = 0)
-        {
-            iterator pos = begin();
-            size_type new_cap = _capacity;
-            
-            size_type dist = ft::distance(first, last);
-            
-
-            size_type new_size = _size + dist;
-            
-            if (new_size > _capacity)
-                new_cap = increasingCapacity(dist);
-            
-            if (new_cap == 0 || dist == 0 )
-                return ;
-            
-            if (new_cap > max_size())
-                throw std::length_error("_Maximum_size_out");
-            // if (position == end())
-            // {
-            //     while (first != last)
-            //         push_back(*first++);
-            //     _capacity = new_cap;
-            //     return;
-            // }
-            
-            value_type *tmp = _alloc.allocate(new_cap);
-            // std::cout << " insert InputIterator\n";
-            // typename InputIterator::value_type val;
-            size_type i = 0;
-            size_type a = 0;
-            size_type e = 0;
-            while(i < new_size){
-                if (pos == position) {
-                    while (first != last) {
-                        try
-                        {
-                            e++;
-                            _alloc.construct(_alloc.address(tmp[i++]), *first++);
-                            
-                        }
-                        catch(...)
-                        {
-                            while (e-- > 0)
-                                _alloc.destroy(_alloc.address(tmp[--i]));
-                            _alloc.deallocate(tmp, new_cap);
-                            throw ;
-                        }        
-                    }
-                }
-                if (pos != end())
-                    _alloc.construct(_alloc.address(tmp[i++]), arr[a++]);
-                ++pos;
-            }
-            deallocateArray();
-            arr = tmp;
-            _capacity = new_cap;
-            _size = new_size;
-        }
+        using base_type::capacity;
+        using base_type::empty;
+        using base_type::reserve;
+        using base_type::shrink_to_fit;
 
-        iterator erase (iterator position) { return erase(position, position + 1); }
-        
-        iterator erase (iterator first, iterator last)
+        // destroys the elements and gives the buffer back to the allocator;
+        // the vector stays usable, with capacity() == 0
+        void release_storage()
         {
-            size_type dist = ft::distance(first, last);
-            // iterator it = begin();
-            // while(first != it++);
-            // while(last != it++) dist++;
-            if (dist == 0)
-                return begin();
-            size_type i = ft::distance(begin(), first);
-            for (; i < _size - dist; i++) {
-                _alloc.destroy(_alloc.address(arr[i]));
-                _alloc.construct(_alloc.address(arr[i]), arr[i + dist]); 
-                _alloc.destroy(_alloc.address(arr[i + dist]));
-            }
-            _size -= dist;
-            return first;
-        }
-        
-        void swap( vector& other ) {
-                ft::swap(_alloc, other._alloc);
-				ft::swap(_capacity, other._capacity);
-				ft::swap(arr, other.arr);
-				ft::swap(_size, other._size);
+            dropElements();
+            reallocateTo(0);
         }
-        
-        void clear() {
-            for (size_type i = 0; i < _size; ++i)
-                _alloc.destroy(_alloc.address(arr[i]));
-            _size = 0;
-        }
-        
+
+//==============================================================================
+
+// Modifiers:-------------------------------------------------------------------
+        using base_type::assign;
+        using base_type::push_back;
+        using base_type::pop_back;
+# if __cplusplus >= 201103L
+        using base_type::emplace_back;
+        using base_type::emplace;
+# endif
+        using base_type::insert;
+        using base_type::erase;
+        using base_type::erase_if;
+        using base_type::clear;
+
+        void swap( vector& other )  {   this->swapBuffers(other);   }
+
  // ============================================================================
- 
+
 // Iterators:-------------------------------------------------------------------
-        iterator                begin()         { return iterator(arr);                 };
-        iterator                end()           { return iterator(arr+_size);           };
-        const_iterator          begin() const   { return const_iterator(arr);           };
-        const_iterator          end() const     { return const_iterator (arr+_size);    };
-        iterator                cbegin() const  { return iterator(arr);                 };
-        iterator                cend() const    { return iterator(arr+_size);           };
-    
-        reverse_iterator		rbegin() 		{   return reverse_iterator(end());		    };
-        const_reverse_iterator	rbegin() const  {	return const_reverse_iterator(end());	};
-        reverse_iterator		rend() 			{	return reverse_iterator(begin());		};
-        const_reverse_iterator	rend() const 	{	return const_reverse_iterator(begin());	};
+        using base_type::begin;
+        using base_type::end;
+        using base_type::rbegin;
+        using base_type::rend;
+        iterator                cbegin() const  { return iterator(arr, this);                   };
+        iterator                cend() const    { return iterator(arr+_size, this);             };
 //==============================================================================
 
 // ALLOCATOR:-------------------------------------------------------------------
-			A get_allocator() const    { return _alloc; }
+        using base_type::get_allocator;
+//==============================================================================
+
+// GROWTH POLICY:---------------------------------------------------------------
+        using base_type::growth_policy;
 //==============================================================================
     };
 // END CLASS VECTOR ************************************************************
 
+    // compared through the operators in VectorBase.hpp
+    template <class T, class Alloc, class G>
+    struct is_vector_like< vector<T,Alloc,G> > : public true_type {};
 
-template <class T, class Alloc>
-	bool	operator == (const vector<T,Alloc>& l, const vector<T,Alloc>& r)
-	{
-		if (l.size() != r.size())	return false;
-		return ft::equal(l.begin(), l.end(), r.begin());
-	};
-
-	template <class T, class Alloc>
-	bool	operator != ( const vector<T,Alloc>& l,
-						 const vector<T,Alloc>& r )			
-    {	return !(l == r);		};
-
-	template <class T, class Alloc>
-	bool	operator < ( const vector<T,Alloc>& l,
-						 const vector<T,Alloc>& r )			
-    {	return ft::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());		};
-
-	template <class T, class Alloc>
-	bool	operator <= ( const vector<T,Alloc>& l,
-						 const vector<T,Alloc>& r )			
-    {	return !(r < l);		};
-
-	template <class T, class Alloc>
-	bool	operator > ( const vector<T,Alloc>& l,
-						 const vector<T,Alloc>& r )			
-    {	return r < l;			};
-
-	template <class T, class Alloc>
-	bool	operator >= ( const vector<T,Alloc>& l,
-						 const vector<T,Alloc>& r )			
-    {	return !(l < r);		};
-
-	template <class T, class Alloc>
-	void	swap(vector<T,Alloc>& x, vector<T,Alloc>& y)	
+	template <class T, class Alloc, class G>
+	void	swap(vector<T,Alloc,G>& x, vector<T,Alloc,G>& y)
     {	x.swap(y);				};
 
+	template <class T, class Alloc, class G, class Predicate>
+	typename vector<T,Alloc,G>::size_type	erase_if(vector<T,Alloc,G>& c, Predicate pred)
+    {	return c.erase_if(pred);	};
+
 
 } // endnamespace ft
 
+# include "VectorBool.hpp"
+
 #endif